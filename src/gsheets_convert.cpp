@@ -0,0 +1,270 @@
+#include <cmath>
+#include <cstring>
+
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/operator/decimal_cast_operators.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include "gsheets_convert.hpp"
+
+namespace duckdb {
+
+using CellKind = sheets::CellValue::Kind;
+
+// Serial number of 1970-01-01, serial numbers count days from 1899-12-30
+static constexpr double SERIAL_UNIX_EPOCH = 25569;
+
+static Value CellToValue(const sheets::CellValue &cell) {
+	switch (cell.kind) {
+	case CellKind::NUMBER:
+		return Value::DOUBLE(cell.number);
+	case CellKind::BOOLEAN:
+		return Value::BOOLEAN(cell.number != 0);
+	default:
+		return Value(cell.Text());
+	}
+}
+
+string CellToString(const sheets::CellValue &cell) {
+	switch (cell.kind) {
+	case CellKind::NUMBER:
+		if (cell.number == std::floor(cell.number) && std::fabs(cell.number) < 1e15) {
+			return std::to_string(static_cast<int64_t>(cell.number));
+		}
+		return Value::DOUBLE(cell.number).ToString();
+	case CellKind::BOOLEAN:
+		return cell.number != 0 ? "TRUE" : "FALSE";
+	default:
+		return cell.Text();
+	}
+}
+
+static inline string_t CellText(const sheets::CellValue &cell) {
+	return string_t(cell.data, cell.size);
+}
+
+static inline bool TextEquals(const sheets::CellValue &cell, const char *text, uint32_t size) {
+	return cell.size == size && memcmp(cell.data, text, size) == 0;
+}
+
+// Conversions of a cell into T. Try returns false when the cell doesn't fit, the regular cast then raises
+// the conversion error.
+template <class T>
+struct CastCell {
+	static bool Try(const sheets::CellValue &cell, T &result) {
+		if (cell.kind != CellKind::STRING) {
+			return false;
+		}
+		return TryCast::Operation<string_t, T>(CellText(cell), result, false);
+	}
+};
+
+struct BooleanCell {
+	static bool Try(const sheets::CellValue &cell, bool &result) {
+		if (cell.kind == CellKind::BOOLEAN) {
+			result = cell.number != 0;
+			return true;
+		}
+		// Sheets formats booleans as TRUE and FALSE
+		if (cell.kind == CellKind::STRING && (TextEquals(cell, "TRUE", 4) || TextEquals(cell, "FALSE", 5))) {
+			result = cell.size == 4;
+			return true;
+		}
+		return CastCell<bool>::Try(cell, result);
+	}
+};
+
+struct BigintCell {
+	static bool Try(const sheets::CellValue &cell, int64_t &result) {
+		if (cell.kind == CellKind::NUMBER) {
+			if (cell.number != std::floor(cell.number) || std::fabs(cell.number) >= 9.2e18) {
+				return false;
+			}
+			result = static_cast<int64_t>(cell.number);
+			return true;
+		}
+		return CastCell<int64_t>::Try(cell, result);
+	}
+};
+
+struct DoubleCell {
+	static bool Try(const sheets::CellValue &cell, double &result) {
+		if (cell.kind == CellKind::NUMBER) {
+			result = cell.number;
+			return true;
+		}
+		return CastCell<double>::Try(cell, result);
+	}
+};
+
+struct DateCell {
+	static bool Try(const sheets::CellValue &cell, date_t &result) {
+		if (cell.kind == CellKind::NUMBER) {
+			auto days = std::floor(cell.number) - SERIAL_UNIX_EPOCH;
+			if (!std::isfinite(days) || std::fabs(days) > 1e9) {
+				return false;
+			}
+			result = date_t(static_cast<int32_t>(days));
+			return true;
+		}
+		return CastCell<date_t>::Try(cell, result);
+	}
+};
+
+struct TimestampCell {
+	static bool Try(const sheets::CellValue &cell, timestamp_t &result) {
+		if (cell.kind == CellKind::NUMBER) {
+			auto micros = std::round((cell.number - SERIAL_UNIX_EPOCH) * Interval::MICROS_PER_DAY);
+			if (!std::isfinite(micros) || std::fabs(micros) > 9.2e18) {
+				return false;
+			}
+			result = timestamp_t(static_cast<int64_t>(micros));
+			return true;
+		}
+		return CastCell<timestamp_t>::Try(cell, result);
+	}
+};
+
+// Cells of one output column of a chunk: blank_rows blank rows, then the cells from first_row onwards
+struct RowSource {
+	const SheetRows &rows;
+	idx_t col;
+	idx_t blank_rows;
+	idx_t first_row;
+
+	sheets::CellValue Get(idx_t i) const {
+		return i < blank_rows ? sheets::CellValue() : rows.Get(first_row + i - blank_rows, col);
+	}
+};
+
+struct ColumnSource {
+	const SheetColumns &columns;
+	idx_t col;
+	idx_t blank_rows;
+	idx_t first_row;
+
+	sheets::CellValue Get(idx_t i) const {
+		return i < blank_rows ? sheets::CellValue() : columns.Get(col, first_row + i - blank_rows);
+	}
+};
+
+template <class T, class OP, class SOURCE>
+static void ConvertColumn(const SOURCE &source, idx_t count, Vector &result) {
+	auto data = FlatVector::GetData<T>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto cell = source.Get(i);
+		if (cell.IsEmpty()) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		if (!OP::Try(cell, data[i])) {
+			// Let the regular cast raise its conversion error
+			data[i] = CellToValue(cell).DefaultCastAs(result.GetType()).template GetValueUnsafe<T>();
+		}
+	}
+}
+
+template <class SOURCE>
+static void ConvertDecimalColumn(const SOURCE &source, idx_t count, Vector &result) {
+	D_ASSERT(result.GetType().InternalType() == PhysicalType::INT64);
+	auto data = FlatVector::GetData<int64_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	auto width = DecimalType::GetWidth(result.GetType());
+	auto scale = DecimalType::GetScale(result.GetType());
+	CastParameters parameters;
+	for (idx_t i = 0; i < count; i++) {
+		auto cell = source.Get(i);
+		if (cell.IsEmpty()) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		bool converted = false;
+		if (cell.kind == CellKind::NUMBER) {
+			converted = TryCastToDecimal::Operation<double, int64_t>(cell.number, data[i], parameters, width, scale);
+		} else if (cell.kind == CellKind::STRING) {
+			converted =
+			    TryCastToDecimal::Operation<string_t, int64_t>(CellText(cell), data[i], parameters, width, scale);
+		}
+		if (!converted) {
+			data[i] = CellToValue(cell).DefaultCastAs(result.GetType()).GetValueUnsafe<int64_t>();
+		}
+	}
+}
+
+template <class SOURCE>
+static void ConvertVarcharColumn(const SOURCE &source, idx_t count, Vector &result) {
+	auto data = FlatVector::GetData<string_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto cell = source.Get(i);
+		if (cell.IsEmpty()) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		if (cell.kind == CellKind::STRING) {
+			data[i] = StringVector::AddString(result, cell.data, cell.size);
+		} else {
+			data[i] = StringVector::AddString(result, CellToString(cell));
+		}
+	}
+}
+
+template <class SOURCE>
+static void ConvertVector(const SOURCE &source, idx_t count, Vector &result) {
+	switch (result.GetType().id()) {
+	case LogicalTypeId::BOOLEAN:
+		ConvertColumn<bool, BooleanCell>(source, count, result);
+		break;
+	case LogicalTypeId::BIGINT:
+		ConvertColumn<int64_t, BigintCell>(source, count, result);
+		break;
+	case LogicalTypeId::DOUBLE:
+		ConvertColumn<double, DoubleCell>(source, count, result);
+		break;
+	case LogicalTypeId::DECIMAL:
+		ConvertDecimalColumn(source, count, result);
+		break;
+	case LogicalTypeId::DATE:
+		ConvertColumn<date_t, DateCell>(source, count, result);
+		break;
+	case LogicalTypeId::TIMESTAMP:
+		ConvertColumn<timestamp_t, TimestampCell>(source, count, result);
+		break;
+	default:
+		ConvertVarcharColumn(source, count, result);
+		break;
+	}
+}
+
+static inline bool SetNullColumn(idx_t cell, Vector &result) {
+	if (cell != DConstants::INVALID_INDEX) {
+		return false;
+	}
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::SetNull(result, true);
+	return true;
+}
+
+void ConvertSheetRows(const vector<LogicalType> &types, const vector<idx_t> &cells, const SheetRows &rows,
+                      idx_t blank_rows, idx_t first_row, idx_t count, DataChunk &output) {
+	for (idx_t col = 0; col < output.ColumnCount(); col++) {
+		D_ASSERT(output.data[col].GetType() == types[col]);
+		if (!SetNullColumn(cells[col], output.data[col])) {
+			ConvertVector(RowSource {rows, cells[col], blank_rows, first_row}, count, output.data[col]);
+		}
+	}
+}
+
+void ConvertSheetColumns(const vector<LogicalType> &types, const vector<idx_t> &cells, const SheetColumns &columns,
+                         idx_t blank_rows, idx_t first_row, idx_t count, DataChunk &output) {
+	for (idx_t col = 0; col < output.ColumnCount(); col++) {
+		D_ASSERT(output.data[col].GetType() == types[col]);
+		if (!SetNullColumn(cells[col], output.data[col])) {
+			ConvertVector(ColumnSource {columns, cells[col], blank_rows, first_row}, count, output.data[col]);
+		}
+	}
+}
+
+} // namespace duckdb
@@ -25,6 +25,7 @@ GSheetCopyFunction::GSheetCopyFunction() : CopyFunction("gsheet") {
 	copy_to_initialize_global = GSheetWriteInitializeGlobal;
 	copy_to_initialize_local = GSheetWriteInitializeLocal;
 	copy_to_sink = GSheetWriteSink;
+	copy_to_finalize = GSheetWriteFinalize;
 }
 
 unique_ptr<FunctionData> GSheetCopyFunction::GSheetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
@@ -177,6 +178,19 @@ void GSheetCopyFunction::GSheetWriteSink(ExecutionContext &context, FunctionData
 	if (!sheet_range.empty()) {
 		range_str += "!" + sheet_range;
 	}
-	client.Spreadsheets(gstate.spreadsheet_id).Values().Append(sheets::A1Range(range_str), data);
+	if (gstate.pending_append.valid()) {
+		// Rethrows an error of the previous append
+		gstate.pending_append.get();
+	}
+	gstate.pending_append =
+	    client.Spreadsheets(gstate.spreadsheet_id).Values().AppendAsync(sheets::A1Range(range_str), data);
+}
+
+void GSheetCopyFunction::GSheetWriteFinalize(ClientContext &context, FunctionData &bind_data,
+                                             GlobalFunctionData &gstate_p) {
+	auto &gstate = gstate_p.Cast<GSheetCopyGlobalState>();
+	if (gstate.pending_append.valid()) {
+		gstate.pending_append.get();
+	}
 }
 } // namespace duckdb
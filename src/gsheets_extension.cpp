@@ -13,9 +13,11 @@
 #include "gsheets_extension.hpp"
 #include "gsheets_auth.hpp"
 #include "gsheets_copy.hpp"
+#include "gsheets_metrics.hpp"
 #include "gsheets_read.hpp"
 
 // Utils
+#include "utils/settings.hpp"
 #include "utils/version.hpp"
 
 // OpenSSL linked through vcpkg
@@ -52,18 +54,39 @@ static void LoadInternal(ExtensionLoader &loader) {
 	OpenSSL_add_all_algorithms();
 
 	// Register read_gsheet table function
-	TableFunction read_gsheet_function("read_gsheet", {LogicalType::VARCHAR}, ReadSheetFunction, ReadSheetBind);
+	TableFunction read_gsheet_function("read_gsheet", {LogicalType::VARCHAR}, ReadSheetFunction, ReadSheetBind,
+	                                   ReadSheetInitGlobal, ReadSheetInitLocal);
+	read_gsheet_function.get_partition_data = ReadSheetGetPartitionData;
+	read_gsheet_function.projection_pushdown = true;
+	read_gsheet_function.pushdown_complex_filter = ReadSheetPushdownComplexFilter;
+	read_gsheet_function.cardinality = ReadSheetCardinality;
+	read_gsheet_function.statistics = ReadSheetStatistics;
 	read_gsheet_function.named_parameters["header"] = LogicalType::BOOLEAN;
-	read_gsheet_function.named_parameters["sheet"] = LogicalType::VARCHAR;
+	// A sheet name, a pattern such as 'Data_*' or a list of either
+	read_gsheet_function.named_parameters["sheet"] = LogicalType::ANY;
 	read_gsheet_function.named_parameters["range"] = LogicalType::VARCHAR;
 	read_gsheet_function.named_parameters["all_varchar"] = LogicalType::BOOLEAN;
+	read_gsheet_function.named_parameters["page_size"] = LogicalType::BIGINT;
+	read_gsheet_function.named_parameters["filter_pushdown"] = LogicalType::BOOLEAN;
+	read_gsheet_function.named_parameters["skip"] = LogicalType::BIGINT;
+	read_gsheet_function.named_parameters["max_rows"] = LogicalType::BIGINT;
+	read_gsheet_function.named_parameters["sample_size"] = LogicalType::BIGINT;
+	read_gsheet_function.named_parameters["formatted"] = LogicalType::BOOLEAN;
+
+	// read_gsheet also takes a list of spreadsheets, unioned by column name
+	TableFunctionSet read_gsheet_set("read_gsheet");
+	read_gsheet_set.AddFunction(read_gsheet_function);
+	read_gsheet_function.arguments = {LogicalType::LIST(LogicalType::VARCHAR)};
+	read_gsheet_set.AddFunction(read_gsheet_function);
 
 	GSheetCopyFunction gsheet_copy_function;
 
-	loader.RegisterFunction(read_gsheet_function);
+	loader.RegisterFunction(read_gsheet_set);
 	loader.RegisterFunction(gsheet_copy_function);
 	CreateGsheetSecretFunctions::Register(loader);
+	GSheetsMetricsFunctions::Register(loader);
 	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	sheets::RegisterSettings(config);
 
 	config.replacement_scans.emplace_back(ReadSheetReplacement);
 }
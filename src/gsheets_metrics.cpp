@@ -0,0 +1,99 @@
+#include <map>
+#include <string>
+
+#include "duckdb/function/table_function.hpp"
+
+#include "gsheets_metrics.hpp"
+#include "sheets/transport/client_factory.hpp"
+
+namespace duckdb {
+
+struct GSheetsMetricsState : public GlobalTableFunctionState {
+	vector<std::pair<string, int64_t>> rows;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> GSheetsMetricsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"name", "value"};
+	return_types = {LogicalType::VARCHAR, LogicalType::BIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> GSheetsMetricsInit(ClientContext &context,
+                                                               TableFunctionInitInput &input) {
+	auto state = make_uniq<GSheetsMetricsState>();
+	auto cache = sheets::GetResponseCache(context);
+	// The cache counters are listed before any request has been made
+	std::map<string, int64_t> counters = {{sheets::CACHE_HITS_METRIC, 0},
+	                                      {sheets::CACHE_MISSES_METRIC, 0},
+	                                      {sheets::CACHE_EVICTIONS_METRIC, 0}};
+	for (auto &counter : sheets::GetMetrics(context)->Snapshot()) {
+		counters[counter.first] = counter.second;
+	}
+	counters["cache_entries"] = static_cast<int64_t>(cache->EntryCount());
+	counters["cache_bytes"] = static_cast<int64_t>(cache->ByteCount());
+	auto disk = sheets::GetDiskResponseStore(context);
+	if (disk) {
+		counters["disk_cache_files"] = static_cast<int64_t>(disk->FileCount());
+		counters["disk_cache_bytes"] = static_cast<int64_t>(disk->ByteCount());
+	}
+	state->rows.assign(counters.begin(), counters.end());
+	return std::move(state);
+}
+
+static void GSheetsMetricsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<GSheetsMetricsState>();
+	idx_t count = 0;
+	while (state.offset < state.rows.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &row = state.rows[state.offset++];
+		output.SetValue(0, count, Value(row.first));
+		output.SetValue(1, count, Value::BIGINT(row.second));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+struct GSheetsCacheClearState : public GlobalTableFunctionState {
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> GSheetsCacheClearBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"entries"};
+	return_types = {LogicalType::BIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> GSheetsCacheClearInit(ClientContext &context,
+                                                                  TableFunctionInitInput &input) {
+	return make_uniq<GSheetsCacheClearState>();
+}
+
+// Empties the response cache, and the cache directory when one is set, and returns the number of entries removed
+static void GSheetsCacheClearFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<GSheetsCacheClearState>();
+	if (state.done) {
+		return;
+	}
+	state.done = true;
+	auto removed = sheets::GetResponseCache(context)->Clear();
+	auto disk = sheets::GetDiskResponseStore(context);
+	if (disk) {
+		removed += disk->Clear();
+	}
+	output.SetValue(0, 0, Value::BIGINT(static_cast<int64_t>(removed)));
+	output.SetCardinality(1);
+}
+
+void GSheetsMetricsFunctions::Register(ExtensionLoader &loader) {
+	TableFunction metrics_function("gsheets_metrics", {}, GSheetsMetricsFunction, GSheetsMetricsBind,
+	                               GSheetsMetricsInit);
+	loader.RegisterFunction(metrics_function);
+
+	TableFunction cache_clear_function("gsheets_cache_clear", {}, GSheetsCacheClearFunction, GSheetsCacheClearBind,
+	                                   GSheetsCacheClearInit);
+	loader.RegisterFunction(cache_clear_function);
+}
+
+} // namespace duckdb
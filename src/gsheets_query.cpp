@@ -0,0 +1,173 @@
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+
+#include "gsheets_query.hpp"
+
+namespace duckdb {
+
+static const QueryColumn *GetQueryColumn(const Expression &expr, idx_t table_index,
+                                         const vector<QueryColumn> &columns) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &colref = expr.Cast<BoundColumnRefExpression>();
+	if (colref.depth > 0 || colref.binding.table_index != table_index ||
+	    colref.binding.column_index >= columns.size()) {
+		return nullptr;
+	}
+	auto &column = columns[colref.binding.column_index];
+	return column.letter.empty() ? nullptr : &column;
+}
+
+// Formats a constant as a query literal of the column's type
+static bool TryFormatLiteral(const QueryColumn &column, const Value &value, ExpressionType comparison,
+                             string &result) {
+	if (value.IsNull()) {
+		return false;
+	}
+	bool equality = comparison == ExpressionType::COMPARE_EQUAL || comparison == ExpressionType::COMPARE_NOTEQUAL;
+	switch (column.type.id()) {
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DOUBLE: {
+		if (!value.type().IsNumeric()) {
+			return false;
+		}
+		if (value.type().IsIntegral() || value.type().id() == LogicalTypeId::DECIMAL) {
+			result = value.ToString();
+			return true;
+		}
+		auto number = value.GetValue<double>();
+		if (!std::isfinite(number)) {
+			return false;
+		}
+		std::ostringstream out;
+		out << std::setprecision(17) << number;
+		result = out.str();
+		return true;
+	}
+	case LogicalTypeId::BOOLEAN:
+		if (!equality || value.type().id() != LogicalTypeId::BOOLEAN) {
+			return false;
+		}
+		result = value.GetValue<bool>() ? "true" : "false";
+		return true;
+	case LogicalTypeId::VARCHAR: {
+		// Ordering of strings may differ from DuckDB's, so only equality is pushed down
+		if (!equality || value.type().id() != LogicalTypeId::VARCHAR) {
+			return false;
+		}
+		// Query strings have no escapes, they can only be quoted with the quote they don't contain
+		auto str = StringValue::Get(value);
+		if (str.find('\'') == string::npos) {
+			result = "'" + str + "'";
+		} else if (str.find('"') == string::npos) {
+			result = "\"" + str + "\"";
+		} else {
+			return false;
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static const char *ComparisonOperator(ExpressionType type) {
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return "=";
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return "!=";
+	case ExpressionType::COMPARE_LESSTHAN:
+		return "<";
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return ">";
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return "<=";
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return ">=";
+	default:
+		return nullptr;
+	}
+}
+
+// Blank cells read as NULL. The query language returns blank cells of a text column as '' rather than null.
+static string IsBlankCondition(const QueryColumn &column, bool blank) {
+	auto &letter = column.letter;
+	if (column.type.id() != LogicalTypeId::VARCHAR) {
+		return letter + (blank ? " is null" : " is not null");
+	}
+	return blank ? "(" + letter + " is null or " + letter + " = '')"
+	             : "(" + letter + " is not null and " + letter + " != '')";
+}
+
+static bool TryTranslateComparison(const BoundComparisonExpression &comparison, idx_t table_index,
+                                   const vector<QueryColumn> &columns, string &result) {
+	auto type = comparison.GetExpressionType();
+	const Expression *column_expr = comparison.left.get();
+	const Expression *constant_expr = comparison.right.get();
+	if (constant_expr->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		std::swap(column_expr, constant_expr);
+		type = FlipComparisonExpression(type);
+	}
+	auto op = ComparisonOperator(type);
+	auto column = GetQueryColumn(*column_expr, table_index, columns);
+	if (!op || !column || constant_expr->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return false;
+	}
+	string literal;
+	if (!TryFormatLiteral(*column, constant_expr->Cast<BoundConstantExpression>().value, type, literal)) {
+		return false;
+	}
+	// Blank cells compare as NULL in SQL, the query language would match them with != and some ordering
+	result = "(" + IsBlankCondition(*column, false) + " and " + column->letter + " " + op + " " + literal + ")";
+	return true;
+}
+
+bool TryTranslateFilter(const Expression &filter, idx_t table_index, const vector<QueryColumn> &columns,
+                        string &result) {
+	switch (filter.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON:
+		return TryTranslateComparison(filter.Cast<BoundComparisonExpression>(), table_index, columns, result);
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = filter.Cast<BoundOperatorExpression>();
+		auto type = op.GetExpressionType();
+		if (op.children.size() != 1 ||
+		    (type != ExpressionType::OPERATOR_IS_NULL && type != ExpressionType::OPERATOR_IS_NOT_NULL)) {
+			return false;
+		}
+		auto column = GetQueryColumn(*op.children[0], table_index, columns);
+		if (!column) {
+			return false;
+		}
+		result = IsBlankCondition(*column, type == ExpressionType::OPERATOR_IS_NULL);
+		return true;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = filter.Cast<BoundConjunctionExpression>();
+		auto separator = conjunction.GetExpressionType() == ExpressionType::CONJUNCTION_AND ? " and " : " or ";
+		string conditions;
+		for (auto &child : conjunction.children) {
+			string condition;
+			if (!TryTranslateFilter(*child, table_index, columns, condition)) {
+				return false;
+			}
+			conditions += (conditions.empty() ? "" : separator) + condition;
+		}
+		result = "(" + conditions + ")";
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
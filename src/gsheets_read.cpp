@@ -1,91 +1,703 @@
+#include <chrono>
+#include <future>
 #include <string>
 
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
 
+#include "gsheets_convert.hpp"
+#include "gsheets_query.hpp"
 #include "gsheets_read.hpp"
+#include "gsheets_sniffer.hpp"
 #include "gsheets_utils.hpp"
 
 #include "sheets/client.hpp"
 #include "sheets/auth_factory.hpp"
 #include "sheets/transport/client_factory.hpp"
+#include "utils/settings.hpp"
 
 namespace duckdb {
 
-bool IsValidNumber(const string &value) {
-	// Skip empty strings
-	if (value.empty()) {
+idx_t ReadSheetBindData::PartitionCount() const {
+	if (next_row == 0 || !query_filters.empty()) {
+		return 1;
+	}
+	if (last_row == 0) {
+		return 0;
+	}
+	return 1 + (last_row - next_row + page_size) / page_size;
+}
+
+idx_t ReadSheetBindData::PartitionFirstRow(idx_t partition_idx) const {
+	return next_row + (partition_idx - 1) * page_size;
+}
+
+idx_t ReadSheetBindData::PartitionRowsRequested(idx_t partition_idx) const {
+	if (partition_idx == 0) {
+		return sample_rows_requested;
+	}
+	if (last_row == 0) {
+		return page_size;
+	}
+	return MinValue(page_size, last_row - PartitionFirstRow(partition_idx) + 1);
+}
+
+// Whether the rows of the partitions that decide the leading blank rows of partition_idx are known
+static bool EarlierPartitionsFetched(ReadSheetGlobalState &gstate, idx_t partition_idx) {
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t i = partition_idx; i-- > 0;) {
+		idx_t fetched = gstate.fetched_rows[i];
+		if (fetched == DConstants::INVALID_INDEX) {
+			return false;
+		}
+		if (fetched > 0) {
+			break;
+		}
+	}
+	return true;
+}
+
+// The API omits trailing blank rows from each window. They belong to the result only if a later window
+// has data, so a partition with data starts with the blank rows that end the partitions before it. Returns false
+// when the scan stopped while waiting for an earlier partition.
+static bool CountLeadingBlankRows(ClientContext &context, const ReadSheetBindData &bind_data,
+                                  ReadSheetGlobalState &gstate, idx_t partition_idx, idx_t &blank_rows) {
+	unique_lock<mutex> guard(gstate.lock);
+	blank_rows = 0;
+	for (idx_t i = partition_idx; i-- > 0;) {
+		// Earlier partitions were claimed first and are published by their thread before it waits itself
+		while (!gstate.stopped && gstate.fetched_rows[i] == DConstants::INVALID_INDEX) {
+			if (context.interrupted) {
+				throw InterruptException();
+			}
+			gstate.partition_fetched.wait_for(guard, std::chrono::milliseconds(100));
+		}
+		if (gstate.stopped) {
+			return false;
+		}
+		idx_t fetched = gstate.fetched_rows[i];
+		idx_t requested = bind_data.PartitionRowsRequested(i);
+		blank_rows += requested > fetched ? requested - fetched : 0;
+		if (fetched > 0) {
+			break;
+		}
+	}
+	return true;
+}
+
+// Sends the request for a partition's window without waiting for the response
+static void StartWindowFetch(const ReadSheetBindData &bind_data, ReadSheetGlobalState &gstate, idx_t partition_idx,
+                             PendingWindow &pending) {
+	pending.partition_idx = partition_idx;
+	pending.first_row = bind_data.PartitionFirstRow(partition_idx);
+	pending.last_row = pending.first_row + bind_data.PartitionRowsRequested(partition_idx) - 1;
+	auto values = gstate.client.Spreadsheets(bind_data.spreadsheet_id).Values();
+	if (gstate.column_runs.empty()) {
+		sheets::A1Range range(bind_data.encoded_sheet_name + "!" +
+		                      sheets::FormatRowWindow(bind_data.bounds, static_cast<int>(pending.first_row),
+		                                              static_cast<int>(pending.last_row)));
+		pending.cells = values.GetCellsAsync(range, bind_data.render, sheets::COLUMNS);
+		return;
+	}
+	// Only the projected column runs are fetched
+	std::vector<sheets::A1Range> ranges;
+	for (auto &run : gstate.column_runs) {
+		ranges.emplace_back(bind_data.encoded_sheet_name + "!" +
+		                    sheets::FormatRowWindow(run, static_cast<int>(pending.first_row),
+		                                            static_cast<int>(pending.last_row)));
+	}
+	pending.runs = values.BatchGetCellsAsync(ranges, bind_data.render, sheets::COLUMNS);
+}
+
+// Waits for the response of a window fetch, for projected runs lays them out side by side. The window's row count
+// is the number of rows it has in the full width of the range.
+static void FinishWindowFetch(const ReadSheetBindData &bind_data, ReadSheetGlobalState &gstate,
+                              PendingWindow &pending) {
+	if (pending.ready) {
+		return;
+	}
+	auto &columns = pending.window;
+	auto &row_count = pending.window_rows;
+	row_count = 0;
+	if (pending.cells.valid()) {
+		columns = pending.cells.get().values;
+		for (idx_t col = 0; col < columns.LineCount(); col++) {
+			row_count = MaxValue<idx_t>(row_count, columns.LineSize(col));
+		}
+		pending.ready = true;
+		return;
+	}
+
+	auto response = pending.runs.get();
+	auto &value_ranges = response.valueRanges;
+	if (value_ranges.size() != gstate.column_runs.size()) {
+		throw IOException("Expected %llu value ranges from Google Sheets, got %llu", idx_t(gstate.column_runs.size()),
+		                  idx_t(value_ranges.size()));
+	}
+	for (idx_t run_idx = 0; run_idx < value_ranges.size(); run_idx++) {
+		auto &run = gstate.column_runs[run_idx];
+		idx_t run_end = columns.LineCount() + run.endColumn - run.startColumn + 1;
+		columns.AppendLines(value_ranges[run_idx].values);
+		// Trailing blank columns of a run are left out of its response
+		while (columns.LineCount() < run_end) {
+			columns.AddLine();
+		}
+	}
+
+	// The API trims trailing rows that are blank in the projected columns, but the row still counts when another
+	// column has data. Rows past the projected ones are read in the full width to find where the window ends.
+	for (idx_t col = 0; col < columns.LineCount(); col++) {
+		row_count = MaxValue<idx_t>(row_count, columns.LineSize(col));
+	}
+	if (pending.first_row + row_count <= pending.last_row) {
+		sheets::A1Range tail(bind_data.encoded_sheet_name + "!" +
+		                     sheets::FormatRowWindow(bind_data.bounds, static_cast<int>(pending.first_row + row_count),
+		                                             static_cast<int>(pending.last_row)));
+		row_count += gstate.client.Spreadsheets(bind_data.spreadsheet_id)
+		                 .Values()
+		                 .GetCells(tail, bind_data.render, sheets::ROWS)
+		                 .values.LineCount();
+	}
+	pending.ready = true;
+}
+
+// Runs the query of the pushed down filters, returns the result rows without the label row
+static SheetRows RunQuery(const ReadSheetBindData &bind_data, ReadSheetGlobalState &gstate) {
+	auto csv_rows = gstate.client.Query(bind_data.spreadsheet_id)
+	                    .Run(bind_data.encoded_sheet_name, url_encode(bind_data.sheet_range),
+	                         bind_data.header ? 1 : 0, url_encode(gstate.query));
+	SheetRows rows;
+	for (idx_t row_idx = 1; row_idx < csv_rows.size(); row_idx++) {
+		rows.AddLine();
+		for (auto &field : csv_rows[row_idx]) {
+			rows.AddString(field.data(), field.size());
+		}
+	}
+	return rows;
+}
+
+// Claims the next partition for the local state, returns false once every partition has been claimed
+static bool TryClaimPartition(ReadSheetGlobalState &gstate, idx_t &partition_idx) {
+	lock_guard<mutex> guard(gstate.lock);
+	if (gstate.finished || gstate.stopped ||
+	    (gstate.partition_count > 0 && gstate.next_partition >= gstate.partition_count)) {
+		return false;
+	}
+	partition_idx = gstate.next_partition++;
+	gstate.fetched_rows.push_back(DConstants::INVALID_INDEX);
+	return true;
+}
+
+static void StopScan(ReadSheetGlobalState &gstate) {
+	{
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.stopped = true;
+	}
+	gstate.partition_fetched.notify_all();
+}
+
+static void PublishFetchedRows(ReadSheetGlobalState &gstate, idx_t partition_idx, idx_t fetched) {
+	{
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.fetched_rows[partition_idx] = fetched;
+		// Without a known last row an empty window is taken as the end of the sheet
+		if (gstate.partition_count == 0 && fetched == 0 && partition_idx > 0) {
+			gstate.finished = true;
+		}
+	}
+	gstate.partition_fetched.notify_all();
+}
+
+ReadSheetLocalState::~ReadSheetLocalState() {
+	if (next_window.partition_idx == DConstants::INVALID_INDEX || next_window.ready) {
+		return;
+	}
+	// A prefetch still in flight uses the client. Its rows will never be published, e.g. when a LIMIT ends the
+	// scan early, so threads waiting for them stop as well.
+	if (next_window.cells.valid()) {
+		next_window.cells.wait();
+	}
+	if (next_window.runs.valid()) {
+		next_window.runs.wait();
+	}
+	StopScan(*gstate);
+}
+
+// Takes the partition prefetched by the local state or claims the next one, and fetches its rows. The window of
+// the partition after it is requested before waiting for this one, so that the request is in flight while this
+// partition is emitted. Returns false once every partition has been claimed or the scan stopped.
+static bool ClaimPartition(ClientContext &context, const ReadSheetBindData &bind_data, ReadSheetGlobalState &gstate,
+                           ReadSheetLocalState &lstate) {
+	PendingWindow pending = std::move(lstate.next_window);
+	lstate.next_window = PendingWindow();
+	idx_t partition_idx = pending.partition_idx;
+	if (partition_idx == DConstants::INVALID_INDEX && !TryClaimPartition(gstate, partition_idx)) {
 		return false;
 	}
 
+	lstate.partition_idx = partition_idx;
+	lstate.row_offset = 0;
+	lstate.rows = nullptr;
+	lstate.query_rows.Clear();
+	lstate.window.Clear();
+	lstate.window_rows = 0;
+	lstate.cells = gstate.column_runs.empty() ? &gstate.sample_cells : &gstate.window_cells;
 	try {
-		// Try to parse as double
-		size_t processed;
-		std::stod(value, &processed);
-		// Ensure the entire string was processed
-		return processed == value.length();
+		if (partition_idx == 0 && gstate.query.empty()) {
+			lstate.rows = &bind_data.sample;
+			lstate.cells = &gstate.sample_cells;
+		} else if (!gstate.query.empty()) {
+			lstate.query_rows = RunQuery(bind_data, gstate);
+			lstate.rows = &lstate.query_rows;
+			lstate.cells = &gstate.window_cells;
+		} else if (pending.partition_idx == DConstants::INVALID_INDEX) {
+			StartWindowFetch(bind_data, gstate, partition_idx, pending);
+		}
+		// Queries are read as a single partition, there is nothing to prefetch
+		idx_t next_partition;
+		if (gstate.query.empty() && TryClaimPartition(gstate, next_partition)) {
+			StartWindowFetch(bind_data, gstate, next_partition, lstate.next_window);
+		}
+		if (pending.partition_idx != DConstants::INVALID_INDEX) {
+			FinishWindowFetch(bind_data, gstate, pending);
+			lstate.window = std::move(pending.window);
+			lstate.window_rows = pending.window_rows;
+		}
 	} catch (...) {
-		return false;
+		StopScan(gstate);
+		throw;
+	}
+
+	idx_t fetched = lstate.RowCount();
+	PublishFetchedRows(gstate, partition_idx, fetched);
+	lstate.blank_rows = 0;
+	if (fetched == 0) {
+		return true;
 	}
+
+	// Other threads may be waiting for the prefetched partition, so it is finished and published before waiting
+	// for theirs. Otherwise two threads could each wait for the other's prefetch.
+	auto &next_window = lstate.next_window;
+	if (next_window.partition_idx != DConstants::INVALID_INDEX && !EarlierPartitionsFetched(gstate, partition_idx)) {
+		try {
+			FinishWindowFetch(bind_data, gstate, next_window);
+		} catch (...) {
+			StopScan(gstate);
+			throw;
+		}
+		PublishFetchedRows(gstate, next_window.partition_idx, next_window.window_rows);
+	}
+	return CountLeadingBlankRows(context, bind_data, gstate, partition_idx, lstate.blank_rows);
 }
 
 void ReadSheetFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	const auto &bind_data = data_p.bind_data->Cast<ReadSheetBindData>();
+	auto &gstate = data_p.global_state->Cast<ReadSheetGlobalState>();
+	auto &lstate = data_p.local_state->Cast<ReadSheetLocalState>();
+
+	// A chunk never spans two partitions so that its batch index is exact
+	while (lstate.blank_rows == 0 && lstate.row_offset >= lstate.RowCount()) {
+		if (!ClaimPartition(context, bind_data, gstate, lstate)) {
+			output.SetCardinality(0);
+			return;
+		}
+	}
 
-	if (bind_data.finished) {
+	idx_t blank_count = MinValue<idx_t>(lstate.blank_rows, STANDARD_VECTOR_SIZE);
+	idx_t row_count = MinValue<idx_t>(lstate.RowCount() - lstate.row_offset, STANDARD_VECTOR_SIZE - blank_count);
+	if (lstate.rows) {
+		ConvertSheetRows(gstate.types, *lstate.cells, *lstate.rows, blank_count, lstate.row_offset,
+		                 blank_count + row_count, output);
+	} else {
+		ConvertSheetColumns(gstate.types, *lstate.cells, lstate.window, blank_count, lstate.row_offset,
+		                    blank_count + row_count, output);
+	}
+	lstate.blank_rows -= blank_count;
+	lstate.row_offset += row_count;
+
+	// Release the window as soon as it has been emitted
+	if (lstate.blank_rows == 0 && lstate.row_offset >= lstate.RowCount()) {
+		lstate.query_rows.Clear();
+		lstate.window.Clear();
+	}
+
+	output.SetCardinality(blank_count + row_count);
+}
+
+unique_ptr<GlobalTableFunctionState> ReadSheetInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<ReadSheetBindData>();
+	idx_t partition_count = bind_data.PartitionCount();
+	idx_t max_threads = 1;
+	if (partition_count > 0) {
+		auto max_concurrency =
+		    sheets::GetBigintSetting(context, sheets::MAX_CONCURRENCY_SETTING, sheets::DEFAULT_MAX_CONCURRENCY);
+		max_threads = MinValue<idx_t>(partition_count, MaxValue<int64_t>(max_concurrency, 1));
+	}
+	auto gstate = make_uniq<ReadSheetGlobalState>(*bind_data.http, *bind_data.auth, partition_count, max_threads);
+
+	idx_t column_count = bind_data.return_types.size();
+	vector<bool> projected(column_count, false);
+	idx_t projected_count = 0;
+	for (auto column_id : input.column_ids) {
+		if (column_id < column_count) {
+			gstate->types.push_back(bind_data.return_types[column_id]);
+			gstate->sample_cells.push_back(column_id);
+			projected_count += projected[column_id] ? 0 : 1;
+			projected[column_id] = true;
+		} else {
+			// The row id, read_gsheet has no stable row ids so it is always NULL
+			gstate->types.push_back(LogicalType::ROW_TYPE);
+			gstate->sample_cells.push_back(DConstants::INVALID_INDEX);
+		}
+	}
+
+	// Windows only fetch the projected columns. Without any projected column (e.g. count(*)) the full width is
+	// fetched so that rows with data anywhere are counted.
+	bool run_query = !bind_data.query_filters.empty();
+	if (!run_query && (bind_data.next_row == 0 || projected_count == 0 || projected_count == column_count)) {
+		return std::move(gstate);
+	}
+	if (projected_count == 0) {
+		std::fill(projected.begin(), projected.end(), true);
+	}
+	int first_column = bind_data.bounds.HasColumns() ? bind_data.bounds.startColumn : 1;
+	vector<idx_t> window_cell(column_count, DConstants::INVALID_INDEX);
+	idx_t window_width = 0;
+	vector<string> select;
+	vector<string> labels;
+	for (idx_t col = 0; col < column_count; col++) {
+		if (!projected[col]) {
+			continue;
+		}
+		int sheet_column = first_column + static_cast<int>(col);
+		if (run_query) {
+			auto letter = sheets::ColumnIndexToLetters(sheet_column);
+			select.push_back(letter);
+			// Labels make sure the result starts with a label row, even when the range has no header
+			labels.push_back(letter + " 'c" + std::to_string(col + 1) + "'");
+		} else if (col > 0 && projected[col - 1]) {
+			gstate->column_runs.back().endColumn = sheet_column;
+		} else {
+			sheets::GridBounds run;
+			run.startColumn = sheet_column;
+			run.endColumn = sheet_column;
+			gstate->column_runs.push_back(run);
+		}
+		window_cell[col] = window_width++;
+	}
+	if (run_query) {
+		gstate->query = "select " + StringUtil::Join(select, ", ") + " where " +
+		                StringUtil::Join(bind_data.query_filters, " and ") + " label " + StringUtil::Join(labels, ", ");
+	}
+	for (auto cell : gstate->sample_cells) {
+		gstate->window_cells.push_back(cell == DConstants::INVALID_INDEX ? cell : window_cell[cell]);
+	}
+	return std::move(gstate);
+}
+
+unique_ptr<LocalTableFunctionState> ReadSheetInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                       GlobalTableFunctionState *global_state) {
+	auto lstate = make_uniq<ReadSheetLocalState>();
+	lstate->gstate = &global_state->Cast<ReadSheetGlobalState>();
+	return std::move(lstate);
+}
+
+void ReadSheetPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                    vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<ReadSheetBindData>();
+	// Nothing to save when the bind sample already holds every row. Query results are always formatted, so
+	// they can't be mixed with an unformatted read.
+	if (!bind_data.filter_pushdown || bind_data.next_row == 0 || bind_data.render != sheets::FORMATTED_VALUE) {
 		return;
 	}
 
-	idx_t row_count = 0;
-	idx_t column_count = output.ColumnCount();
+	int first_column = bind_data.bounds.HasColumns() ? bind_data.bounds.startColumn : 1;
+	vector<QueryColumn> columns;
+	for (auto &column_index : get.GetColumnIds()) {
+		QueryColumn column;
+		auto col = column_index.GetPrimaryIndex();
+		if (col < bind_data.return_types.size()) {
+			column.letter = sheets::ColumnIndexToLetters(first_column + static_cast<int>(col));
+			column.type = bind_data.return_types[col];
+		}
+		columns.push_back(std::move(column));
+	}
 
-	// Adjust starting index based on whether we're using the header
-	idx_t start_index = bind_data.header ? bind_data.row_index + 1 : bind_data.row_index;
+	for (idx_t i = 0; i < filters.size(); i++) {
+		string condition;
+		if (TryTranslateFilter(*filters[i], get.table_index, columns, condition)) {
+			bind_data.query_filters.push_back(std::move(condition));
+			filters.erase_at(i);
+			i--;
+		}
+	}
+}
 
-	for (idx_t i = start_index; i < bind_data.values.size() && row_count < STANDARD_VECTOR_SIZE; i++) {
-		const auto &row = bind_data.values[i];
-		for (idx_t col = 0; col < column_count; col++) {
-			if (col < row.size()) {
-				const string &value = row[col];
-				switch (bind_data.return_types[col].id()) {
-				case LogicalTypeId::BOOLEAN:
-					if (value.empty()) {
-						output.SetValue(col, row_count, Value(LogicalType::BOOLEAN));
-					} else {
-						output.SetValue(col, row_count, Value(value).DefaultCastAs(LogicalType::BOOLEAN));
-					}
-					break;
-				case LogicalTypeId::DOUBLE:
-					if (value.empty()) {
-						output.SetValue(col, row_count, Value(LogicalType::DOUBLE));
-					} else {
-						output.SetValue(col, row_count, Value(value).DefaultCastAs(LogicalType::DOUBLE));
-					}
-					break;
-				default:
-					// Empty strings should be converted to NULL
-					if (value.empty()) {
-						output.SetValue(col, row_count, Value(LogicalType::VARCHAR));
-					} else {
-						output.SetValue(col, row_count, Value(value));
-					}
-					break;
+OperatorPartitionData ReadSheetGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	auto &lstate = input.local_state->Cast<ReadSheetLocalState>();
+	return OperatorPartitionData(lstate.partition_idx);
+}
+
+unique_ptr<NodeStatistics> ReadSheetCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<ReadSheetBindData>();
+	idx_t sampled = bind_data.sample.LineCount();
+	if (bind_data.next_row == 0) {
+		return make_uniq<NodeStatistics>(sampled, sampled);
+	}
+	if (bind_data.last_row == 0) {
+		// At least the sample, how far the sheet goes on is only known once windows come back empty
+		return make_uniq<NodeStatistics>(sampled);
+	}
+	// The last row usually comes from the grid size, which includes the blank rows at the bottom of the sheet.
+	// A sample that came back short suggests the data ends within it.
+	idx_t max_rows = bind_data.sample_rows_requested + bind_data.last_row - bind_data.next_row + 1;
+	idx_t estimate = sampled < bind_data.sample_rows_requested ? sampled : max_rows;
+	return make_uniq<NodeStatistics>(estimate, max_rows);
+}
+
+unique_ptr<BaseStatistics> ReadSheetStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                               column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<ReadSheetBindData>();
+	// Statistics have to hold for every row, so they are only known when the sample is the whole result
+	if (bind_data.next_row != 0 || column_index >= bind_data.return_types.size()) {
+		return nullptr;
+	}
+	auto &type = bind_data.return_types[column_index];
+	vector<LogicalType> types {type};
+	vector<idx_t> cells {column_index};
+	auto stats = BaseStatistics::CreateEmpty(type);
+
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), types);
+	idx_t sampled = bind_data.sample.LineCount();
+	for (idx_t offset = 0; offset < sampled; offset += STANDARD_VECTOR_SIZE) {
+		idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, sampled - offset);
+		chunk.Reset();
+		ConvertSheetRows(types, cells, bind_data.sample, 0, offset, count, chunk);
+		chunk.SetCardinality(count);
+		for (idx_t i = 0; i < count; i++) {
+			stats.Merge(BaseStatistics::FromConstant(chunk.data[0].GetValue(i)));
+		}
+	}
+	return stats.ToUnique();
+}
+
+// One sheet read as part of a union
+struct SheetPart {
+	string spreadsheet_id;
+	string sheet_name;
+	SheetRows values;
+};
+
+// The sheets of one spreadsheet that go into a union: the sheets matching the patterns, or without patterns the
+// sheet of sheet_gid (from the URL) or the first sheet
+static std::vector<sheets::SheetMetadata> ResolveUnionSheets(const sheets::SpreadsheetMetadata &meta,
+                                                             const string &sheet_gid, const vector<string> &patterns) {
+	std::vector<sheets::SheetMetadata> sheet_list;
+	if (!patterns.empty()) {
+		sheet_list = sheets::FindSheetsByPattern(meta, patterns);
+		if (sheet_list.empty()) {
+			throw InvalidInputException("No sheet matches '%s'", StringUtil::Join(patterns, "', '"));
+		}
+	} else if (!sheet_gid.empty()) {
+		sheet_list.push_back(sheets::FindSheetById(meta, std::stoi(sheet_gid)));
+	} else {
+		sheet_list.push_back(sheets::FindSheetByIndex(meta, 0));
+	}
+	return sheet_list;
+}
+
+static std::vector<sheets::A1Range> UnionRanges(const std::vector<sheets::SheetMetadata> &sheet_list,
+                                                const string &sheet_range) {
+	std::vector<sheets::A1Range> ranges;
+	for (auto &sheet : sheet_list) {
+		ranges.emplace_back(url_encode(sheet.properties.title) + (sheet_range.empty() ? "" : "!" + sheet_range));
+	}
+	return ranges;
+}
+
+static void AddSheetParts(const string &spreadsheet_id, const std::vector<sheets::SheetMetadata> &sheet_list,
+                          sheets::BatchGetCellsResponse response, vector<SheetPart> &parts) {
+	auto &value_ranges = response.valueRanges;
+	if (value_ranges.size() != sheet_list.size()) {
+		throw IOException("Expected %llu value ranges from Google Sheets, got %llu", idx_t(sheet_list.size()),
+		                  idx_t(value_ranges.size()));
+	}
+	for (idx_t i = 0; i < sheet_list.size(); i++) {
+		parts.push_back(SheetPart {spreadsheet_id, sheet_list[i].properties.title, std::move(value_ranges[i].values)});
+	}
+}
+
+// Fetches the sheets of one spreadsheet that go into a union with one metadata request and one batchGet
+static void FetchSheetParts(sheets::GoogleSheetsClient &client, const string &spreadsheet_id, const string &sheet_gid,
+                            const vector<string> &patterns, const string &sheet_range,
+                            sheets::ValueRenderOption render, vector<SheetPart> &parts) {
+	auto spreadsheet = client.Spreadsheets(spreadsheet_id);
+	auto sheet_list = ResolveUnionSheets(spreadsheet.Get(), sheet_gid, patterns);
+	auto response = spreadsheet.Values().BatchGetCells(UnionRanges(sheet_list, sheet_range), render);
+	AddSheetParts(spreadsheet_id, sheet_list, std::move(response), parts);
+}
+
+// A spreadsheet of a union whose requests are in flight
+struct PendingSpreadsheet {
+	string spreadsheet_id;
+	string sheet_gid;
+	string sheet_range;
+	std::future<sheets::SpreadsheetMetadata> metadata;
+	std::vector<sheets::SheetMetadata> sheet_list;
+	std::future<sheets::BatchGetCellsResponse> values;
+};
+
+// Fetches the sheet parts of every spreadsheet, keeping up to max_concurrency spreadsheets in flight. Requests are
+// sent without waiting for each other: all metadata requests of a batch go out first, then each batchGet as soon as
+// its metadata is in. The parts are returned in input order.
+static vector<SheetPart> FetchSpreadsheetParts(sheets::GoogleSheetsClient &client, const vector<string> &inputs,
+                                               const vector<string> &patterns, const string &sheet_range,
+                                               sheets::ValueRenderOption render, idx_t max_concurrency) {
+	vector<SheetPart> parts;
+	for (idx_t batch_start = 0; batch_start < inputs.size(); batch_start += max_concurrency) {
+		idx_t batch_end = MinValue<idx_t>(batch_start + max_concurrency, inputs.size());
+		vector<PendingSpreadsheet> pending;
+		try {
+			for (idx_t i = batch_start; i < batch_end; i++) {
+				auto &input = inputs[i];
+				PendingSpreadsheet spreadsheet;
+				spreadsheet.spreadsheet_id = extract_spreadsheet_id(input);
+				spreadsheet.sheet_gid = extract_sheet_id(input);
+				spreadsheet.sheet_range = sheet_range.empty() ? extract_sheet_range(input) : sheet_range;
+				spreadsheet.metadata = client.Spreadsheets(spreadsheet.spreadsheet_id).GetAsync();
+				pending.push_back(std::move(spreadsheet));
+			}
+			for (auto &spreadsheet : pending) {
+				spreadsheet.sheet_list =
+				    ResolveUnionSheets(spreadsheet.metadata.get(), spreadsheet.sheet_gid, patterns);
+				auto ranges = UnionRanges(spreadsheet.sheet_list, spreadsheet.sheet_range);
+				spreadsheet.values =
+				    client.Spreadsheets(spreadsheet.spreadsheet_id).Values().BatchGetCellsAsync(ranges, render);
+			}
+			for (auto &spreadsheet : pending) {
+				AddSheetParts(spreadsheet.spreadsheet_id, spreadsheet.sheet_list, spreadsheet.values.get(), parts);
+			}
+		} catch (...) {
+			// Requests still in flight use the client, wait for them before it goes away
+			for (auto &spreadsheet : pending) {
+				if (spreadsheet.metadata.valid()) {
+					spreadsheet.metadata.wait();
+				}
+				if (spreadsheet.values.valid()) {
+					spreadsheet.values.wait();
 				}
-			} else {
-				output.SetValue(col, row_count, Value(nullptr));
 			}
+			throw;
 		}
-		row_count++;
 	}
+	return parts;
+}
 
-	bind_data.row_index += row_count;
-	bind_data.finished = (bind_data.row_index >= (bind_data.values.size() - (bind_data.header ? 1 : 0)));
+// Unions sheets by column name, case-insensitively and in the order the columns first appear, optionally
+// followed by sheet_name and spreadsheet_id columns. The sheets are read whole at bind time, as the sample.
+static unique_ptr<ReadSheetBindData> BindSheetUnion(vector<SheetPart> &parts, bool header, idx_t skip,
+                                                    idx_t max_rows, bool use_all_varchars, bool add_sheet_name,
+                                                    bool add_spreadsheet_id, vector<LogicalType> &return_types,
+                                                    vector<string> &names) {
+	// Union column of each sheet column
+	case_insensitive_map_t<idx_t> column_index;
+	vector<vector<idx_t>> part_columns(parts.size());
+	for (idx_t part_idx = 0; part_idx < parts.size(); part_idx++) {
+		auto &values = parts[part_idx].values;
+		values.RemoveFirstLines(skip);
+		vector<string> header_row;
+		if (header && !values.Empty()) {
+			for (idx_t i = 0; i < values.LineSize(0); i++) {
+				header_row.push_back(CellToString(values.Get(0, i)));
+			}
+			values.RemoveFirstLines(1);
+		}
+		if (max_rows > 0) {
+			values.Truncate(max_rows);
+		}
+		idx_t width = header_row.size();
+		for (idx_t row = 0; row < values.LineCount(); row++) {
+			width = MaxValue<idx_t>(width, values.LineSize(row));
+		}
+		for (idx_t i = 0; i < width; i++) {
+			string column_name = i < header_row.size() ? header_row[i] : "column" + std::to_string(i + 1);
+			auto entry = column_index.find(column_name);
+			if (entry == column_index.end()) {
+				entry = column_index.emplace(column_name, names.size()).first;
+				names.push_back(column_name);
+			}
+			part_columns[part_idx].push_back(entry->second);
+		}
+	}
+	idx_t column_count = names.size();
+	if (add_sheet_name) {
+		names.push_back("sheet_name");
+	}
+	if (add_spreadsheet_id) {
+		names.push_back("spreadsheet_id");
+	}
 
-	output.SetCardinality(row_count);
+	SheetRows rows;
+	vector<idx_t> source(column_count);
+	for (idx_t part_idx = 0; part_idx < parts.size(); part_idx++) {
+		auto &part = parts[part_idx];
+		std::fill(source.begin(), source.end(), DConstants::INVALID_INDEX);
+		for (idx_t i = 0; i < part_columns[part_idx].size(); i++) {
+			source[part_columns[part_idx][i]] = i;
+		}
+		for (idx_t row = 0; row < part.values.LineCount(); row++) {
+			rows.AddLine();
+			for (idx_t col = 0; col < column_count; col++) {
+				if (source[col] == DConstants::INVALID_INDEX) {
+					rows.AddEmpty();
+				} else {
+					rows.AddCell(part.values.Get(row, source[col]));
+				}
+			}
+			if (add_sheet_name) {
+				rows.AddString(part.sheet_name.data(), part.sheet_name.size());
+			}
+			if (add_spreadsheet_id) {
+				rows.AddString(part.spreadsheet_id.data(), part.spreadsheet_id.size());
+			}
+		}
+		part.values.Clear();
+	}
+	rows.ShrinkToFit();
+
+	if (use_all_varchars) {
+		return_types.assign(names.size(), LogicalType::VARCHAR);
+	} else {
+		// Unioned sheets are read whole at bind time
+		return_types = SniffColumnTypes(rows, names.size(), true);
+	}
+
+	auto bind_data = make_uniq<ReadSheetBindData>(header, std::move(rows));
+	bind_data->spreadsheet_id = parts.empty() ? "" : parts[0].spreadsheet_id;
+	bind_data->sample_rows_requested = bind_data->sample.LineCount();
+	bind_data->names = names;
+	bind_data->return_types = return_types;
+	return bind_data;
 }
 
 unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBindInput &input,
                                        vector<LogicalType> &return_types, vector<string> &names) {
-	auto sheet_input = input.inputs[0].GetValue<string>();
+	// A list of spreadsheets is read concurrently and unioned by name
+	vector<string> spreadsheet_inputs;
+	string sheet_input;
+	if (input.inputs[0].type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(input.inputs[0])) {
+			spreadsheet_inputs.push_back(child.GetValue<string>());
+		}
+		if (spreadsheet_inputs.empty()) {
+			throw InvalidInputException("read_gsheet expects at least one spreadsheet");
+		}
+		sheet_input = spreadsheet_inputs[0];
+	} else {
+		sheet_input = input.inputs[0].GetValue<string>();
+	}
 
 	// Flags
 	bool header = true;
@@ -95,12 +707,24 @@ unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBind
 	// Default values
 	string sheet_name = "";
 	string sheet_id = "";
+	sheets::SheetMetadata sheet;
+	idx_t page_size = DEFAULT_PAGE_SIZE;
+	bool filter_pushdown = false;
+	// Rows skipped at the top of the range, before the header
+	idx_t skip = 0;
+	// Maximum number of data rows to read, 0 for all
+	idx_t max_rows = 0;
+	// Data rows read at bind time to detect the column types, -1 for all
+	int64_t sample_size = DEFAULT_SAMPLE_SIZE;
+	sheets::ValueRenderOption render = sheets::FORMATTED_VALUE;
+	// Sheet names or patterns when several sheets are read at once
+	vector<string> sheet_patterns;
 
 	// Extract the spreadsheet ID from the input (URL or ID)
 	std::string spreadsheet_id = extract_spreadsheet_id(sheet_input);
 
-	// Try to extract the range from the input (URL or ID)
-	std::string sheet_range = extract_sheet_range(sheet_input);
+	// Try to extract the range from the input (URL or ID), each spreadsheet of a list uses its own
+	std::string sheet_range = spreadsheet_inputs.empty() ? extract_sheet_range(sheet_input) : "";
 
 	// Initialize client
 	auto http = sheets::CreateHttpClient(context);
@@ -127,6 +751,15 @@ unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBind
 		} else if (kv.first == "sheet") {
 			// TODO: maybe factor this out to clean up this space
 			use_explicit_sheet_name = true;
+			if (kv.second.type().id() == LogicalTypeId::LIST) {
+				for (auto &child : ListValue::GetChildren(kv.second)) {
+					sheet_patterns.push_back(child.GetValue<string>());
+				}
+				if (sheet_patterns.empty()) {
+					throw InvalidInputException("Invalid value for 'sheet' parameter. Expected at least one sheet.");
+				}
+				continue;
+			}
 			sheet_name = kv.second.GetValue<string>();
 
 			// Check if sheet name is quoted and therefore might contain a `!` char that doesn't indicate A1 notation
@@ -149,12 +782,63 @@ unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBind
 				}
 			}
 
+			// Sheets of a list of spreadsheets are resolved per spreadsheet
+			if (sheets::IsSheetPattern(sheet_name) || !spreadsheet_inputs.empty()) {
+				sheet_patterns.push_back(sheet_name);
+				continue;
+			}
 			// Validate that sheet with name exists for better error messaging
-			auto sheet = client.Spreadsheets(spreadsheet_id).GetSheetByName(sheet_name);
+			sheet = client.Spreadsheets(spreadsheet_id).GetSheetByName(sheet_name);
 			sheet_id = std::to_string(sheet.properties.sheetId);
 		} else if (kv.first == "range") {
 			sheet_range = kv.second.GetValue<string>();
+		} else if (kv.first == "page_size") {
+			auto value = kv.second.GetValue<int64_t>();
+			if (value <= 0) {
+				throw InvalidInputException("Invalid value for 'page_size' parameter. Expected a positive integer.");
+			}
+			page_size = static_cast<idx_t>(value);
+		} else if (kv.first == "skip") {
+			auto value = kv.second.GetValue<int64_t>();
+			if (value < 0) {
+				throw InvalidInputException("Invalid value for 'skip' parameter. Expected a non-negative integer.");
+			}
+			skip = static_cast<idx_t>(value);
+		} else if (kv.first == "max_rows") {
+			auto value = kv.second.GetValue<int64_t>();
+			if (value <= 0) {
+				throw InvalidInputException("Invalid value for 'max_rows' parameter. Expected a positive integer.");
+			}
+			max_rows = static_cast<idx_t>(value);
+		} else if (kv.first == "sample_size") {
+			sample_size = kv.second.GetValue<int64_t>();
+			if (sample_size == 0 || sample_size < -1) {
+				throw InvalidInputException(
+				    "Invalid value for 'sample_size' parameter. Expected a positive integer or -1 for all rows.");
+			}
+		} else if (kv.first == "formatted") {
+			render = kv.second.GetValue<bool>() ? sheets::FORMATTED_VALUE : sheets::UNFORMATTED_VALUE;
+		} else if (kv.first == "filter_pushdown") {
+			filter_pushdown = kv.second.GetValue<bool>();
+		}
+	}
+
+	if (!spreadsheet_inputs.empty() || !sheet_patterns.empty()) {
+		vector<SheetPart> parts;
+		if (spreadsheet_inputs.empty()) {
+			FetchSheetParts(client, spreadsheet_id, "", sheet_patterns, sheet_range, render, parts);
+		} else {
+			auto max_concurrency =
+			    sheets::GetBigintSetting(context, sheets::MAX_CONCURRENCY_SETTING, sheets::DEFAULT_MAX_CONCURRENCY);
+			parts = FetchSpreadsheetParts(client, spreadsheet_inputs, sheet_patterns, sheet_range, render,
+			                              static_cast<idx_t>(MaxValue<int64_t>(max_concurrency, 1)));
 		}
+		auto bind_data = BindSheetUnion(parts, header, skip, max_rows, use_all_varchars, !sheet_patterns.empty(),
+		                                !spreadsheet_inputs.empty(), return_types, names);
+		bind_data->render = render;
+		bind_data->http = std::move(http);
+		bind_data->auth = std::move(auth);
+		return std::move(bind_data);
 	}
 
 	// Get sheet name from URL if not provided as input
@@ -162,11 +846,11 @@ unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBind
 		sheet_id = extract_sheet_id(sheet_input);
 		if (sheet_id.empty()) {
 			// Fallback to first sheet by index
-			auto sheet = client.Spreadsheets(spreadsheet_id).GetSheetByIndex(0);
+			sheet = client.Spreadsheets(spreadsheet_id).GetSheetByIndex(0);
 			sheet_name = sheet.properties.title;
 		} else {
 			try {
-				auto sheet = client.Spreadsheets(spreadsheet_id).GetSheetById(sheet_id);
+				sheet = client.Spreadsheets(spreadsheet_id).GetSheetById(sheet_id);
 				sheet_name = sheet.properties.title;
 			} catch (const std::invalid_argument &e) {
 				throw InvalidInputException("Cannot convert sheet ID " + sheet_id + " to integer:" + e.what());
@@ -176,66 +860,132 @@ unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBind
 		}
 	}
 
-	// Build range and fetch values
 	std::string encoded_sheet_name = url_encode(sheet_name);
+
+	// Only fetch the header and a sample of rows here, the scan pages through the rest of the range.
+	// Ranges that can't be split into rows (e.g. named ranges) are fetched in one go.
+	sheets::GridBounds bounds;
+	bool paginate = sheets::ParseGridBounds(sheet_range, bounds);
+	// Sampling the whole range of a sheet without grid properties can only be done in one request
+	if (sample_size < 0 && bounds.endRow == 0 && sheet.properties.gridProperties.rowCount == 0 && max_rows == 0) {
+		paginate = false;
+	}
+	idx_t first_row = 0;
+	idx_t sample_last_row = 0;
+	idx_t last_row = 0;
 	std::string range_str = encoded_sheet_name;
-	if (!sheet_range.empty()) {
+	if (paginate) {
+		// skip and max_rows narrow the rows requested rather than trimming the response
+		first_row = (bounds.startRow > 0 ? bounds.startRow : 1) + skip;
+		last_row = bounds.endRow;
+		idx_t grid_rows = sheet.properties.gridProperties.rowCount;
+		if (grid_rows > 0 && (last_row == 0 || last_row > grid_rows)) {
+			last_row = grid_rows;
+		}
+		if (max_rows > 0) {
+			idx_t max_last_row = first_row + (header ? 1 : 0) + max_rows - 1;
+			last_row = last_row == 0 ? max_last_row : MinValue(last_row, max_last_row);
+		}
+		if (last_row > 0 && first_row > last_row) {
+			throw InvalidInputException("Range %s is empty", sheet_name + "!" + sheet_range);
+		}
+		if (sample_size < 0) {
+			sample_last_row = last_row;
+		} else {
+			sample_last_row = first_row + (header ? 1 : 0) + static_cast<idx_t>(sample_size) - 1;
+			if (last_row > 0 && sample_last_row > last_row) {
+				sample_last_row = last_row;
+			}
+		}
+		range_str +=
+		    "!" + sheets::FormatRowWindow(bounds, static_cast<int>(first_row), static_cast<int>(sample_last_row));
+	} else if (!sheet_range.empty()) {
 		range_str += "!" + sheet_range;
 	}
 
 	sheets::A1Range range(range_str);
-	auto value_range = client.Spreadsheets(spreadsheet_id).Values().Get(range);
+	auto value_range = client.Spreadsheets(spreadsheet_id).Values().GetCells(range, render);
 
 	// Throw error ourselves to give user a better error message
-	if (value_range.values.empty()) {
+	if (value_range.values.Empty()) {
 		throw duckdb::InvalidInputException("Range %s is empty", value_range.range);
 	}
 
-	auto bind_data = make_uniq<ReadSheetBindData>(header, std::move(value_range.values));
-
-	idx_t start_index = header ? 1 : 0;
-
-	// Use empty row for first row if results are header-only
-	const std::vector<string> empty_row = {};
-	const auto &values = bind_data->values;
-	const auto &first_data_row = start_index >= values.size() ? empty_row : values[start_index];
-
-	// If we have a header, we want the width of the result to be the max of:
-	//      the width of the header row
-	//      or the width of the first row of data
-	size_t result_width = first_data_row.size();
+	vector<string> header_row;
+	auto &values = value_range.values;
+	if (!paginate) {
+		values.RemoveFirstLines(skip);
+		if (values.Empty()) {
+			throw InvalidInputException("Range %s is empty", value_range.range);
+		}
+	}
 	if (header) {
-		size_t header_width = values[0].size();
-		if (header_width > result_width) {
-			result_width = header_width;
+		for (idx_t i = 0; i < values.LineSize(0); i++) {
+			header_row.push_back(CellToString(values.Get(0, i)));
+		}
+		values.RemoveFirstLines(1);
+	}
+	if (!paginate && max_rows > 0) {
+		values.Truncate(max_rows);
+	}
+
+	auto bind_data = make_uniq<ReadSheetBindData>(header, std::move(values));
+	bind_data->spreadsheet_id = spreadsheet_id;
+	bind_data->encoded_sheet_name = encoded_sheet_name;
+	bind_data->bounds = bounds;
+	bind_data->page_size = page_size;
+	bind_data->sheet_range = sheet_range;
+	bind_data->filter_pushdown = filter_pushdown;
+	bind_data->render = render;
+	bind_data->sample_rows_requested = bind_data->sample.LineCount();
+	if (paginate) {
+		bind_data->sample_rows_requested = sample_last_row - first_row + 1 - (header ? 1 : 0);
+		bind_data->last_row = last_row;
+		if (last_row == 0 || sample_last_row < last_row) {
+			bind_data->next_row = sample_last_row + 1;
+		}
+		// Queries read the same rows as the scan, which can't be expressed without a last row
+		if (last_row > 0) {
+			bind_data->sheet_range =
+			    sheets::FormatRowWindow(bounds, static_cast<int>(first_row), static_cast<int>(last_row));
+		} else if (skip > 0) {
+			bind_data->filter_pushdown = false;
 		}
 	}
 
-	for (size_t i = 0; i < result_width; i++) {
+	// The result is as wide as the header or the widest sampled row
+	idx_t result_width = header_row.size();
+	for (idx_t row = 0; row < bind_data->sample.LineCount(); row++) {
+		result_width = MaxValue<idx_t>(result_width, bind_data->sample.LineSize(row));
+	}
+
+	for (idx_t i = 0; i < result_width; i++) {
 		// Assign default column_name, but rename to header value if using a header and header cell exists
 		string column_name = "column" + std::to_string(i + 1);
-		if (header && (i < values[0].size())) {
-			column_name = values[0][i];
+		if (header && (i < header_row.size())) {
+			column_name = header_row[i];
 		}
 		names.push_back(column_name);
+	}
 
-		// If the first row has blanks, assume varchar for now
-		if (i >= first_data_row.size() || use_all_varchars) {
-			return_types.push_back(LogicalType::VARCHAR);
-			continue;
-		}
-		const string &value = first_data_row[i];
-		if (value == "TRUE" || value == "FALSE") {
-			return_types.push_back(LogicalType::BOOLEAN);
-		} else if (IsValidNumber(value)) {
-			return_types.push_back(LogicalType::DOUBLE);
-		} else {
-			return_types.push_back(LogicalType::VARCHAR);
+	if (use_all_varchars) {
+		return_types.assign(result_width, LogicalType::VARCHAR);
+	} else {
+		// Typed numbers don't say whether they are dates, that comes from the number format of the first data row
+		std::vector<std::string> number_formats;
+		if (render == sheets::UNFORMATTED_VALUE && paginate && !bind_data->sample.Empty()) {
+			auto data_row = static_cast<int>(first_row + (header ? 1 : 0));
+			number_formats = client.Spreadsheets(spreadsheet_id)
+			                     .GetNumberFormatTypes(sheets::A1Range(
+			                         encoded_sheet_name + "!" + sheets::FormatRowWindow(bounds, data_row, data_row)));
 		}
+		return_types = SniffColumnTypes(bind_data->sample, result_width, bind_data->next_row == 0, number_formats);
 	}
 
 	bind_data->names = names;
 	bind_data->return_types = return_types;
+	bind_data->http = std::move(http);
+	bind_data->auth = std::move(auth);
 
 	return std::move(bind_data);
 }
@@ -0,0 +1,201 @@
+#include <cmath>
+
+#include "duckdb/common/operator/cast_operators.hpp"
+
+#include "gsheets_sniffer.hpp"
+
+namespace duckdb {
+
+namespace {
+
+// Types a column can still have, narrowed down by each cell
+struct ColumnCandidates {
+	bool has_value = false;
+	bool boolean = true;
+	bool bigint = true;
+	bool decimal = true;
+	bool dbl = true;
+	bool date = true;
+	bool timestamp = true;
+	// Digits after the decimal point, shared by every cell of a DECIMAL column
+	idx_t scale = DConstants::INVALID_INDEX;
+
+	bool Any() const {
+		return boolean || bigint || decimal || dbl || date || timestamp;
+	}
+};
+
+// Shape of a cell written as a plain number, e.g. "-12", "3.50" or "1.2E+10"
+struct NumberShape {
+	idx_t integer_digits = 0;
+	idx_t fraction_digits = 0;
+	bool has_point = false;
+	bool has_exponent = false;
+};
+
+} // namespace
+
+static bool IsDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+// Scans a plain decimal number without exceptions. Integers with leading zeros (e.g. "007") are codes
+// rather than numbers in a sheet, so they are rejected.
+static bool ScanNumber(const char *cell, idx_t size, NumberShape &shape) {
+	idx_t pos = 0;
+	if (pos < size && (cell[pos] == '-' || cell[pos] == '+')) {
+		pos++;
+	}
+	idx_t integer_start = pos;
+	while (pos < size && IsDigit(cell[pos])) {
+		pos++;
+	}
+	shape.integer_digits = pos - integer_start;
+	if (shape.integer_digits > 1 && cell[integer_start] == '0') {
+		return false;
+	}
+	if (pos < size && cell[pos] == '.') {
+		shape.has_point = true;
+		idx_t fraction_start = ++pos;
+		while (pos < size && IsDigit(cell[pos])) {
+			pos++;
+		}
+		shape.fraction_digits = pos - fraction_start;
+	}
+	if (shape.integer_digits + shape.fraction_digits == 0) {
+		return false;
+	}
+	if (pos < size && (cell[pos] == 'e' || cell[pos] == 'E')) {
+		shape.has_exponent = true;
+		pos++;
+		if (pos < size && (cell[pos] == '-' || cell[pos] == '+')) {
+			pos++;
+		}
+		idx_t exponent_start = pos;
+		while (pos < size && IsDigit(cell[pos])) {
+			pos++;
+		}
+		if (pos == exponent_start) {
+			return false;
+		}
+	}
+	return pos == size;
+}
+
+static void SniffCell(const sheets::CellValue &cell, ColumnCandidates &candidates) {
+	candidates.has_value = true;
+	string_t input(cell.data, cell.size);
+
+	candidates.boolean = candidates.boolean && (input == string_t("TRUE") || input == string_t("FALSE"));
+
+	NumberShape shape;
+	if (ScanNumber(cell.data, cell.size, shape)) {
+		candidates.date = false;
+		candidates.timestamp = false;
+		if (candidates.bigint) {
+			int64_t bigint;
+			candidates.bigint = !shape.has_point && !shape.has_exponent &&
+			                    TryCast::Operation<string_t, int64_t>(input, bigint, true);
+		}
+		if (candidates.decimal) {
+			if (candidates.scale == DConstants::INVALID_INDEX) {
+				candidates.scale = shape.fraction_digits;
+			}
+			candidates.decimal = shape.has_point && !shape.has_exponent && shape.fraction_digits > 0 &&
+			                     shape.fraction_digits == candidates.scale &&
+			                     shape.integer_digits + shape.fraction_digits <= SNIFF_DECIMAL_WIDTH;
+		}
+		if (candidates.dbl) {
+			double dbl;
+			candidates.dbl = TryCast::Operation<string_t, double>(input, dbl, true);
+		}
+		return;
+	}
+
+	candidates.bigint = false;
+	candidates.decimal = false;
+	candidates.dbl = false;
+	if (candidates.date) {
+		date_t date;
+		candidates.date = TryCast::Operation<string_t, date_t>(input, date, true);
+	}
+	if (candidates.timestamp) {
+		timestamp_t timestamp;
+		candidates.timestamp = TryCast::Operation<string_t, timestamp_t>(input, timestamp, true);
+	}
+}
+
+// Narrows down the candidates for a typed number. The number format of the column decides between a date, a
+// timestamp and a plain number.
+static void SniffNumber(double number, const std::string &number_format, ColumnCandidates &candidates) {
+	candidates.has_value = true;
+	candidates.boolean = false;
+	candidates.decimal = false;
+	candidates.date = candidates.date && number_format == "DATE";
+	candidates.timestamp = candidates.timestamp && number_format == "DATE_TIME";
+	bool is_date = candidates.date || candidates.timestamp;
+	candidates.bigint =
+	    candidates.bigint && !is_date && number == std::floor(number) && std::fabs(number) < 9.2e18;
+	candidates.dbl = candidates.dbl && !is_date;
+}
+
+static void SniffBoolean(ColumnCandidates &candidates) {
+	candidates.has_value = true;
+	candidates.bigint = false;
+	candidates.decimal = false;
+	candidates.dbl = false;
+	candidates.date = false;
+	candidates.timestamp = false;
+}
+
+vector<LogicalType> SniffColumnTypes(const SheetRows &rows, idx_t column_count, bool complete,
+                                     const std::vector<std::string> &number_formats) {
+	static const std::string NO_FORMAT;
+	vector<ColumnCandidates> columns(column_count);
+	for (idx_t row = 0; row < rows.LineCount(); row++) {
+		idx_t row_size = rows.LineSize(row);
+		for (idx_t col = 0; col < column_count && col < row_size; col++) {
+			auto &candidates = columns[col];
+			auto cell = rows.Get(row, col);
+			if (cell.IsEmpty() || !candidates.Any()) {
+				continue;
+			}
+			switch (cell.kind) {
+			case sheets::CellValue::Kind::NUMBER:
+				SniffNumber(cell.number, col < number_formats.size() ? number_formats[col] : NO_FORMAT, candidates);
+				break;
+			case sheets::CellValue::Kind::BOOLEAN:
+				SniffBoolean(candidates);
+				break;
+			default:
+				SniffCell(cell, candidates);
+				break;
+			}
+		}
+	}
+
+	vector<LogicalType> types;
+	for (auto &candidates : columns) {
+		if (!candidates.has_value) {
+			// Blank in the whole sample, assume text
+			types.push_back(LogicalType::VARCHAR);
+		} else if (candidates.boolean) {
+			types.push_back(LogicalType::BOOLEAN);
+		} else if (candidates.bigint) {
+			types.push_back(LogicalType::BIGINT);
+		} else if (candidates.decimal && complete) {
+			types.push_back(LogicalType::DECIMAL(SNIFF_DECIMAL_WIDTH, static_cast<uint8_t>(candidates.scale)));
+		} else if (candidates.dbl) {
+			types.push_back(LogicalType::DOUBLE);
+		} else if (candidates.date) {
+			types.push_back(LogicalType::DATE);
+		} else if (candidates.timestamp) {
+			types.push_back(LogicalType::TIMESTAMP);
+		} else {
+			types.push_back(LogicalType::VARCHAR);
+		}
+	}
+	return types;
+}
+
+} // namespace duckdb
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+#include "sheets/types.hpp"
+
+namespace duckdb {
+
+// Rows of cells as read from a sheet, one line per row
+using SheetRows = sheets::CellBuffer;
+// Columns of cells as read from a sheet with majorDimension=COLUMNS, one line per column. Each column is trimmed
+// of its own trailing blank cells.
+using SheetColumns = sheets::CellBuffer;
+
+// Text of a cell, e.g. for column names. Unformatted numbers are written out in full and booleans as TRUE/FALSE.
+string CellToString(const sheets::CellValue &cell);
+
+// Converts count rows into the flat vectors of output: blank_rows blank rows, then rows first_row onwards.
+// Output column i has type types[i] and is read from cell cells[i] of each row, or is all NULL when cells[i] is
+// DConstants::INVALID_INDEX (e.g. the row id). Each column is converted in one pass with a single type dispatch,
+// writing straight into the vector data and validity mask. Typed cells (unformatted reads) are stored without
+// going through a string, dates and times are serial numbers. Blank and missing cells become NULL.
+void ConvertSheetRows(const vector<LogicalType> &types, const vector<idx_t> &cells, const SheetRows &rows,
+                      idx_t blank_rows, idx_t first_row, idx_t count, DataChunk &output);
+
+// Column-major version of ConvertSheetRows, output column i is read from column cells[i]. Each column is a
+// contiguous run of cells.
+void ConvertSheetColumns(const vector<LogicalType> &types, const vector<idx_t> &cells, const SheetColumns &columns,
+                         idx_t blank_rows, idx_t first_row, idx_t count, DataChunk &output);
+
+} // namespace duckdb
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <future>
+
 #include "duckdb/function/copy_function.hpp"
 
 #include "sheets/transport/http_client.hpp"
 #include "sheets/auth/auth_provider.hpp"
+#include "sheets/types.hpp"
 
 namespace duckdb {
 struct GSheetCopyGlobalState : public GlobalFunctionData {
@@ -15,12 +18,21 @@ struct GSheetCopyGlobalState : public GlobalFunctionData {
 	                               const string &sheet_name)
 	    : http(std::move(http)), auth(std::move(auth)), spreadsheet_id(spreadsheet_id), sheet_name(sheet_name) {
 	}
+	~GSheetCopyGlobalState() override {
+		// The append uses http, it can't be left running when the copy fails
+		if (pending_append.valid()) {
+			pending_append.wait();
+		}
+	}
 
 public:
 	std::unique_ptr<sheets::IHttpClient> http;
 	std::unique_ptr<sheets::IAuthProvider> auth;
 	string spreadsheet_id;
 	string sheet_name;
+	// Append of the previous chunk, still in flight while the next chunk is converted. It completes before the next
+	// append is sent so that rows keep their order.
+	std::future<sheets::AppendValuesResponse> pending_append;
 };
 
 struct GSheetWriteOptions {
@@ -68,6 +80,8 @@ public:
 
 	static void GSheetWriteSink(ExecutionContext &context, FunctionData &bind_data_p, GlobalFunctionData &gstate,
 	                            LocalFunctionData &lstate, DataChunk &input);
+
+	static void GSheetWriteFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate);
 };
 
 } // namespace duckdb
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "duckdb/main/extension/extension_loader.hpp"
+
+namespace duckdb {
+
+// gsheets_metrics() lists the HTTP counters (cache hits, misses, ...) and gsheets_cache_clear() empties the
+// response cache
+struct GSheetsMetricsFunctions {
+public:
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
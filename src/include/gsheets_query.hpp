@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "duckdb.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+// A column of read_gsheet as seen by a pushed down filter
+struct QueryColumn {
+	// Column letter in the sheet, e.g. "C", empty if the column can't be filtered on (e.g. the row id)
+	string letter;
+	LogicalType type;
+};
+
+// Translates a filter into a Google Visualization API query condition, e.g. "(C is not null and C > 30)".
+// columns maps the column_index of each column binding of the scan to its sheet column. Returns false if
+// the filter can't be expressed, in which case DuckDB has to apply it.
+bool TryTranslateFilter(const Expression &filter, idx_t table_index, const vector<QueryColumn> &columns,
+                        string &result);
+
+} // namespace duckdb
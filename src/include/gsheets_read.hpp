@@ -1,22 +1,149 @@
 #pragma once
 
+#include <condition_variable>
+#include <future>
+
 #include "duckdb.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/node_statistics.hpp"
+
+#include "gsheets_convert.hpp"
+
+#include "sheets/auth/auth_provider.hpp"
+#include "sheets/client.hpp"
+#include "sheets/range.hpp"
+#include "sheets/transport/http_client.hpp"
 
 namespace duckdb {
 
+// Rows fetched per request once the bind sample has been emitted
+constexpr idx_t DEFAULT_PAGE_SIZE = 10000;
+// Data rows fetched at bind time to detect the column types (the sample_size parameter)
+constexpr int64_t DEFAULT_SAMPLE_SIZE = STANDARD_VECTOR_SIZE;
+
 struct ReadSheetBindData : public TableFunctionData {
-	mutable bool finished;
-	mutable idx_t row_index;
 	bool header;
-	std::vector<std::vector<std::string>> values;
+	// Data rows fetched at bind time to detect the column types, emitted first by the scan
+	SheetRows sample;
 	vector<LogicalType> return_types;
 	vector<string> names;
 
-	ReadSheetBindData(bool header, std::vector<std::vector<std::string>> values)
-	    : finished(false), row_index(0), header(header), values(std::move(values)) {
+	std::unique_ptr<sheets::IHttpClient> http;
+	std::unique_ptr<sheets::IAuthProvider> auth;
+	string spreadsheet_id;
+	string encoded_sheet_name;
+
+	// Row window paging, disabled when the range can't be split into rows (e.g. a named range)
+	sheets::GridBounds bounds;
+	idx_t page_size = DEFAULT_PAGE_SIZE;
+	// Data rows requested for the sample, rows past sample.size() were blank
+	idx_t sample_rows_requested = 0;
+	// First sheet row after the sample, 0 if the sample is the whole result
+	idx_t next_row = 0;
+	// Last sheet row to read, 0 if unknown
+	idx_t last_row = 0;
+
+	// FORMATTED_VALUE reads every cell as text, UNFORMATTED_VALUE keeps numbers and booleans typed
+	sheets::ValueRenderOption render = sheets::FORMATTED_VALUE;
+
+	// Range given by the user, without the sheet name
+	string sheet_range;
+	// Whether filters may be pushed down into a Visualization API query (the filter_pushdown parameter)
+	bool filter_pushdown = false;
+	// Pushed down filters as query conditions. When set the scan runs a single query instead of paging.
+	vector<string> query_filters;
+
+	ReadSheetBindData(bool header, SheetRows sample)
+	    : header(header), sample(std::move(sample)) {
+	}
+
+	// Partition 0 is the sample, each later partition is a window of page_size rows.
+	// Returns 0 when the last row is unknown and windows are fetched until one comes back empty.
+	idx_t PartitionCount() const;
+	idx_t PartitionFirstRow(idx_t partition_idx) const;
+	idx_t PartitionRowsRequested(idx_t partition_idx) const;
+};
+
+struct ReadSheetGlobalState : public GlobalTableFunctionState {
+	ReadSheetGlobalState(sheets::IHttpClient &http, sheets::IAuthProvider &auth, idx_t partition_count,
+	                     idx_t max_threads)
+	    : client(http, auth), partition_count(partition_count), max_threads(max_threads) {
+	}
+
+	sheets::GoogleSheetsClient client;
+
+	// Type of each output column and the bind column it is read from, DConstants::INVALID_INDEX for the row id
+	vector<LogicalType> types;
+	vector<idx_t> sample_cells;
+	// Sheet columns fetched for each window, one run per contiguous block of projected columns.
+	// Empty when every column is projected and windows are fetched at full width.
+	vector<sheets::GridBounds> column_runs;
+	// Cell of each output column within a window's rows when column_runs or query is set
+	vector<idx_t> window_cells;
+	// Visualization API query run instead of paging when filters were pushed down
+	string query;
+
+	mutex lock;
+	std::condition_variable partition_fetched;
+	idx_t partition_count;
+	idx_t next_partition = 0;
+	// Rows returned for each claimed partition, DConstants::INVALID_INDEX while its fetch is in flight
+	vector<idx_t> fetched_rows;
+	// Set at the first empty window when the last row is unknown
+	bool finished = false;
+	// Set when a thread failed or ended the scan with a prefetched partition it never published. Threads waiting
+	// for earlier partitions give up.
+	bool stopped = false;
+
+	idx_t max_threads;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+};
+
+// Window of a partition whose request is in flight, or that is ready once its response is in
+struct PendingWindow {
+	idx_t partition_idx = DConstants::INVALID_INDEX;
+	idx_t first_row = 0;
+	idx_t last_row = 0;
+	// Response of a full width window, or of the projected column runs
+	std::future<sheets::CellRange> cells;
+	std::future<sheets::BatchGetCellsResponse> runs;
+	bool ready = false;
+	SheetColumns window;
+	idx_t window_rows = 0;
+};
+
+struct ReadSheetLocalState : public LocalTableFunctionState {
+	~ReadSheetLocalState() override;
+
+	ReadSheetGlobalState *gstate = nullptr;
+
+	// Partition being emitted, used as the batch index
+	idx_t partition_idx = 0;
+	// Rows being emitted: the bind sample for partition 0 or the query result, nullptr for a fetched window
+	const SheetRows *rows = nullptr;
+	SheetRows query_rows;
+	// Fetched window, windows are read column-major so that each output column converts from one line
+	SheetColumns window;
+	// Rows in the window, the length of its longest column
+	idx_t window_rows = 0;
+	// Cell of each output row or window column for each output column
+	const vector<idx_t> *cells = nullptr;
+	idx_t row_offset = 0;
+	// Blank rows to emit before the partition's rows
+	idx_t blank_rows = 0;
+	// Next partition claimed by this thread, requested while the current one is emitted
+	PendingWindow next_window;
+
+	idx_t RowCount() const {
+		return rows ? rows->LineCount() : window_rows;
 	}
 };
 
@@ -25,4 +152,22 @@ void ReadSheetFunction(ClientContext &context, TableFunctionInput &data_p, DataC
 unique_ptr<FunctionData> ReadSheetBind(ClientContext &context, TableFunctionBindInput &input,
                                        vector<LogicalType> &return_types, vector<string> &names);
 
+unique_ptr<GlobalTableFunctionState> ReadSheetInitGlobal(ClientContext &context, TableFunctionInitInput &input);
+
+unique_ptr<LocalTableFunctionState> ReadSheetInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                       GlobalTableFunctionState *global_state);
+
+void ReadSheetPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                    vector<unique_ptr<Expression>> &filters);
+
+OperatorPartitionData ReadSheetGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input);
+
+// Row count estimate for the optimizer, exact when the bind sample is the whole result and otherwise bounded by
+// the last row of the range
+unique_ptr<NodeStatistics> ReadSheetCardinality(ClientContext &context, const FunctionData *bind_data_p);
+
+// Min/max and null statistics of a column, computed from the bind sample when it is the whole result
+unique_ptr<BaseStatistics> ReadSheetStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                               column_t column_index);
+
 } // namespace duckdb
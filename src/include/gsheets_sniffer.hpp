@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "duckdb.hpp"
+
+#include "gsheets_convert.hpp"
+
+namespace duckdb {
+
+// Widest DECIMAL the sniffer detects, stored in an int64
+constexpr uint8_t SNIFF_DECIMAL_WIDTH = 18;
+
+// Detects the type of the first column_count columns from a sample of rows. Each column gets the narrowest of
+// BOOLEAN, BIGINT, DECIMAL, DOUBLE, DATE and TIMESTAMP that fits every non-blank cell, otherwise VARCHAR.
+// Numbers written as text only become DECIMAL when every cell has the same number of decimals (e.g. "12.50"), and
+// only when complete is set because rows holds the whole result: a row past the sample with more decimals would be
+// rounded, so such columns are DOUBLE otherwise. Typed numbers (unformatted reads) carry no format, number_formats
+// holds the number format type of each column (e.g. "DATE" or "DATE_TIME") so that serial dates are told apart
+// from plain numbers.
+vector<LogicalType> SniffColumnTypes(const SheetRows &rows, idx_t column_count, bool complete,
+                                     const std::vector<std::string> &number_formats = {});
+
+} // namespace duckdb
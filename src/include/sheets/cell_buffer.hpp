@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+namespace sheets {
+
+// A cell read with its JSON type. Formatted reads only return strings, unformatted reads keep numbers
+// (including dates and times, as serial numbers) and booleans typed.
+struct CellValue {
+	enum class Kind : uint8_t { EMPTY, STRING, NUMBER, BOOLEAN };
+
+	Kind kind = Kind::EMPTY;
+	// The value of a NUMBER cell, 1 or 0 for a BOOLEAN cell
+	double number = 0;
+	// The text of a STRING cell, owned by the CellBuffer the cell was read from
+	const char *data = nullptr;
+	uint32_t size = 0;
+
+	bool IsEmpty() const {
+		return kind == Kind::EMPTY;
+	}
+
+	std::string Text() const {
+		return size ? std::string(data, size) : std::string();
+	}
+};
+
+// The cells of a range in a flat layout: the text of every cell is stored in one arena and each cell is a
+// fixed size entry, grouped into lines (rows, or columns for majorDimension=COLUMNS). A line may be shorter
+// than the others, the API leaves out trailing blank cells. Cells returned by Get point into the arena and are
+// only valid until the buffer is modified.
+class CellBuffer {
+public:
+	// Starts a new line, cells are added to the last line
+	void AddLine();
+	void AddString(const char *data, size_t size);
+	void AddNumber(double number);
+	void AddBoolean(bool value);
+	void AddEmpty();
+	// Adds a copy of a cell, e.g. one read from another buffer
+	void AddCell(const CellValue &cell);
+	// Appends copies of the lines of other
+	void AppendLines(const CellBuffer &other);
+	// Drops the first count lines without moving the others
+	void RemoveFirstLines(size_t count);
+	// Keeps the first count lines
+	void Truncate(size_t count);
+	// Removes every line and releases the memory
+	void Clear();
+	// Releases the spare capacity left by growing the buffer, once every cell has been added
+	void ShrinkToFit();
+
+	size_t LineCount() const {
+		return line_starts.size() - first_line;
+	}
+	bool Empty() const {
+		return LineCount() == 0;
+	}
+	size_t LineSize(size_t line) const;
+	// Cell index of a line, an EMPTY cell when the line is shorter
+	CellValue Get(size_t line, size_t index) const;
+
+	// Bytes allocated for the cells
+	size_t MemoryUsage() const;
+
+private:
+	struct Entry {
+		CellValue::Kind kind;
+		uint32_t size;
+		union {
+			double number;
+			uint64_t offset;
+		};
+	};
+
+	void AddEntry(const Entry &entry);
+
+	std::vector<char> arena;
+	std::vector<Entry> entries;
+	// Index of the first entry of each line
+	std::vector<size_t> line_starts;
+	// Lines before first_line have been removed
+	size_t first_line = 0;
+};
+
+} // namespace sheets
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "utils/version.hpp"
 
 #include "sheets/auth/auth_provider.hpp"
+#include "sheets/resources/query.hpp"
 #include "sheets/resources/spreadsheet.hpp"
 #include "sheets/transport/http_client.hpp"
 #include "sheets/transport/http_type.hpp"
@@ -11,21 +12,28 @@ namespace duckdb {
 namespace sheets {
 
 constexpr const char *DEFAULT_SHEETS_API_URL = "https://sheets.googleapis.com/v4";
+constexpr const char *DEFAULT_QUERY_API_URL = "https://docs.google.com/spreadsheets/d";
 
 class GoogleSheetsClient {
 public:
-	GoogleSheetsClient(IHttpClient &http, IAuthProvider &auth, const std::string &baseUrl = DEFAULT_SHEETS_API_URL)
-	    : http(http), headers(BuildHeaders(auth)), baseUrl(baseUrl) {
+	GoogleSheetsClient(IHttpClient &http, IAuthProvider &auth, const std::string &baseUrl = DEFAULT_SHEETS_API_URL,
+	                   const std::string &queryUrl = DEFAULT_QUERY_API_URL)
+	    : http(http), headers(BuildHeaders(auth)), baseUrl(baseUrl), queryUrl(queryUrl) {
 	}
 
 	SpreadsheetResource Spreadsheets(const std::string &spreadsheetId) {
 		return SpreadsheetResource(http, headers, baseUrl, spreadsheetId);
 	}
 
+	QueryResource Query(const std::string &spreadsheetId) {
+		return QueryResource(http, headers, queryUrl, spreadsheetId);
+	}
+
 private:
 	IHttpClient &http;
 	HttpHeaders headers;
 	std::string baseUrl;
+	std::string queryUrl;
 
 	static HttpHeaders BuildHeaders(IAuthProvider &auth) {
 		HttpHeaders h;
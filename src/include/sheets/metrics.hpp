@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace duckdb {
+namespace sheets {
+
+// Counter names
+constexpr const char *CACHE_HITS_METRIC = "cache_hits";
+constexpr const char *CACHE_MISSES_METRIC = "cache_misses";
+constexpr const char *CACHE_EVICTIONS_METRIC = "cache_evictions";
+constexpr const char *CACHE_VALIDATIONS_METRIC = "cache_validations";
+constexpr const char *CACHE_VALIDATION_ERRORS_METRIC = "cache_validation_errors";
+constexpr const char *METADATA_CACHE_HITS_METRIC = "metadata_cache_hits";
+constexpr const char *METADATA_CACHE_MISSES_METRIC = "metadata_cache_misses";
+constexpr const char *DISK_CACHE_HITS_METRIC = "disk_cache_hits";
+constexpr const char *DISK_CACHE_EVICTIONS_METRIC = "disk_cache_evictions";
+// Connections opened, reused from the pool, and closed after idling for too long
+constexpr const char *CONNECTIONS_OPENED_METRIC = "http_connections_opened";
+constexpr const char *CONNECTIONS_REUSED_METRIC = "http_connections_reused";
+constexpr const char *CONNECTIONS_EXPIRED_METRIC = "http_connections_expired";
+// Bytes sent and received over the network, and before encoding or after decoding
+constexpr const char *REQUEST_BYTES_METRIC = "http_request_bytes";
+constexpr const char *REQUEST_BYTES_UNCOMPRESSED_METRIC = "http_request_bytes_uncompressed";
+constexpr const char *RESPONSE_BYTES_METRIC = "http_response_bytes";
+constexpr const char *RESPONSE_BYTES_DECOMPRESSED_METRIC = "http_response_bytes_decompressed";
+// Retries of failed requests, milliseconds waited before them, and requests that still failed after the last retry
+constexpr const char *RETRIES_METRIC = "http_retries";
+constexpr const char *RETRY_WAIT_MS_METRIC = "http_retry_wait_ms";
+constexpr const char *RETRIES_EXHAUSTED_METRIC = "http_retries_exhausted";
+// Requests held back by the database's request scheduler and the milliseconds they waited
+constexpr const char *SCHEDULER_WAITS_METRIC = "http_scheduler_waits";
+constexpr const char *SCHEDULER_WAIT_MS_METRIC = "http_scheduler_wait_ms";
+// GETs sent a second time after taking longer than most, and hedges that answered first
+constexpr const char *HEDGED_REQUESTS_METRIC = "http_hedged_requests";
+constexpr const char *HEDGE_WINS_METRIC = "http_hedge_wins";
+
+// Named counters of HTTP activity, shared by every client
+class Metrics {
+public:
+	void Increment(const std::string &name, int64_t delta = 1);
+	int64_t Get(const std::string &name) const;
+	// Counters sorted by name
+	std::vector<std::pair<std::string, int64_t>> Snapshot() const;
+	void Reset();
+
+private:
+	mutable std::mutex lock;
+	std::map<std::string, int64_t> counters;
+};
+
+} // namespace sheets
+} // namespace duckdb
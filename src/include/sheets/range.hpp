@@ -20,5 +20,28 @@ private:
 	std::string range;
 };
 
+// Cell bounds of the part of an A1 range after the sheet name, e.g. "B2:D" or "5:10".
+// Columns and rows are 1-based; 0 means the bound is open.
+struct GridBounds {
+	int startColumn = 0;
+	int startRow = 0;
+	int endColumn = 0;
+	int endRow = 0;
+
+	bool HasColumns() const {
+		return startColumn > 0;
+	}
+};
+
+// Parses cell bounds such as "A1", "A1:B7", "A:C", "A5:A" or "2:10" ("$" markers are ignored).
+// An empty string is the whole sheet. Returns false for anything else, e.g. named ranges.
+bool ParseGridBounds(const std::string &cells, GridBounds &bounds);
+
+// Formats the rows [firstRow, lastRow] of the columns in bounds, e.g. "B10:D20" or "10:20"
+std::string FormatRowWindow(const GridBounds &bounds, int firstRow, int lastRow);
+
+int ColumnLettersToIndex(const std::string &letters);
+std::string ColumnIndexToLetters(int index);
+
 } // namespace sheets
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #pragma once
+#include <future>
 #include <string>
 
 #include "sheets/transport/http_client.hpp"
@@ -19,6 +20,9 @@ protected:
 	HttpResponse DoGet(const std::string &path);
 	HttpResponse DoPost(const std::string &path, const std::string &body);
 	HttpResponse DoPut(const std::string &path, const std::string &body);
+
+	std::future<HttpResponse> DoGetAsync(const std::string &path);
+	std::future<HttpResponse> DoPostAsync(const std::string &path, const std::string &body);
 };
 
 } // namespace sheets
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "sheets/resources/base.hpp"
+#include "sheets/transport/http_client.hpp"
+#include "sheets/transport/http_type.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Google Visualization API query endpoint (gviz/tq) of a spreadsheet
+class QueryResource : protected BaseResource {
+public:
+	QueryResource(IHttpClient &http, const HttpHeaders &headers, const std::string &baseUrl,
+	              const std::string &spreadsheetId)
+	    : BaseResource(http, headers, baseUrl), spreadsheetId(spreadsheetId) {};
+
+	// Runs a query against the sheet and returns the result table as CSV rows of formatted values, the
+	// first row holding the column labels. sheet, range and query must already be URL-encoded; an empty
+	// range is the whole sheet. headers is the number of header rows at the top of the range.
+	std::vector<std::vector<std::string>> Run(const std::string &sheet, const std::string &range, int headers,
+	                                          const std::string &query);
+
+private:
+	std::string spreadsheetId;
+};
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+
 #include "sheets/resources/base.hpp"
 #include "sheets/resources/values.hpp"
 #include "sheets/types.hpp"
@@ -7,6 +9,15 @@
 namespace duckdb {
 namespace sheets {
 
+// Whether a sheet name given by the user is a pattern for GetSheetsByPattern, e.g. "Data_*"
+bool IsSheetPattern(const std::string &name);
+
+// Lookups in metadata that was already fetched, throwing SheetNotFoundException like the SpreadsheetResource methods
+SheetMetadata FindSheetById(const SpreadsheetMetadata &meta, int sheetId);
+SheetMetadata FindSheetByIndex(const SpreadsheetMetadata &meta, int index);
+std::vector<SheetMetadata> FindSheetsByPattern(const SpreadsheetMetadata &meta,
+                                               const std::vector<std::string> &patterns);
+
 class SpreadsheetResource : protected BaseResource {
 public:
 	SpreadsheetResource(IHttpClient &http, const HttpHeaders &headers, const std::string &baseUrl,
@@ -14,14 +25,21 @@ public:
 	    : BaseResource(http, headers, baseUrl), spreadsheetId(spreadsheetId) {};
 
 	SpreadsheetMetadata Get();
+	std::future<SpreadsheetMetadata> GetAsync();
 
 	SheetMetadata GetSheetById(const int sheetId);
 	SheetMetadata GetSheetById(const std::string &sheetId);
 	SheetMetadata GetSheetByName(const std::string &name);
 	SheetMetadata GetSheetByIndex(const int index);
+	// Sheets whose title matches any of the patterns, in spreadsheet order, from a single metadata request.
+	// Patterns may use the * and ? wildcards, a pattern without wildcards has to name an existing sheet.
+	std::vector<SheetMetadata> GetSheetsByPattern(const std::vector<std::string> &patterns);
 
 	SheetMetadata CreateSheet(const std::string &name);
 
+	// Number format type of each cell in the first row of range (e.g. "DATE"), empty where none is set
+	std::vector<std::string> GetNumberFormatTypes(const A1Range &range);
+
 	ValuesResource Values();
 
 private:
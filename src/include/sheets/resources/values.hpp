@@ -1,5 +1,8 @@
 #pragma once
 
+#include <future>
+#include <vector>
+
 #include "sheets/range.hpp"
 #include "sheets/resources/base.hpp"
 #include "sheets/transport/http_client.hpp"
@@ -16,12 +19,30 @@ public:
 	    : BaseResource(http, headers, baseUrl), spreadsheetId(spreadsheetId) {};
 
 	ValueRange Get(const A1Range &range);
+	// Reads a range keeping the JSON type of each cell. With COLUMNS each entry of values is a column.
+	CellRange GetCells(const A1Range &range, ValueRenderOption render = FORMATTED_VALUE, MajorDimension major = ROWS);
+	// Reads several ranges in one request, the ranges are returned in the order requested
+	BatchGetCellsResponse BatchGetCells(const std::vector<A1Range> &ranges, ValueRenderOption render = FORMATTED_VALUE,
+	                                    MajorDimension major = ROWS);
+	// Variants that return once the request is sent, the response is decoded by the thread getting the result
+	std::future<CellRange> GetCellsAsync(const A1Range &range, ValueRenderOption render = FORMATTED_VALUE,
+	                                     MajorDimension major = ROWS);
+	std::future<BatchGetCellsResponse> BatchGetCellsAsync(const std::vector<A1Range> &ranges,
+	                                                      ValueRenderOption render = FORMATTED_VALUE,
+	                                                      MajorDimension major = ROWS);
+	std::future<AppendValuesResponse> AppendAsync(const A1Range &range, const ValueRange &values);
+
 	UpdateValuesResponse Update(const A1Range &range, const ValueRange &values);
 	AppendValuesResponse Append(const A1Range &range, const ValueRange &values);
 	ClearValuesResponse Clear(const A1Range &range);
 
 private:
 	std::string spreadsheetId;
+
+	std::string GetCellsPath(const A1Range &range, ValueRenderOption render, MajorDimension major);
+	std::string BatchGetCellsPath(const std::vector<A1Range> &ranges, ValueRenderOption render,
+	                              MajorDimension major);
+	std::string AppendPath(const A1Range &range);
 };
 
 } // namespace sheets
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/disk_response_store.hpp"
+#include "sheets/transport/http_client.hpp"
+#include "sheets/transport/response_cache.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+constexpr const char *DEFAULT_DRIVE_API_URL = "https://www.googleapis.com/drive/v3";
+
+struct CacheOptions {
+	// How long a cached response is served, zero disables lookups (writes still invalidate)
+	std::chrono::milliseconds ttl {0};
+	// How long a spreadsheet metadata response is served from the shared cache, zero to only reuse it within
+	// the client
+	std::chrono::milliseconds metadataTtl {0};
+	// Check the spreadsheet's Drive version before serving a cached response
+	bool validate = false;
+	std::string driveUrl = DEFAULT_DRIVE_API_URL;
+	// Prefix of the cache keys, so that clients using different credentials don't share responses
+	std::string scope;
+};
+
+// Serves repeated cell value reads (values, values:batchGet and Visualization API queries) from a shared
+// ResponseCache, and from a DiskResponseStore when one is given. Responses on disk may be from an earlier process
+// and are only served after checking the spreadsheet's Drive version. The version is read at most once per
+// spreadsheet per client, when a cached response has to be checked or a response has to be stored with it.
+// Spreadsheet metadata is fetched once per client, which lives for one statement, and shared between clients for
+// metadataTtl. Any other request passes through, and writes drop the cached responses of their spreadsheet.
+class CachingHttpClient : public IHttpClient {
+public:
+	CachingHttpClient(std::unique_ptr<IHttpClient> inner, std::shared_ptr<ResponseCache> cache,
+	                  std::shared_ptr<Metrics> metrics, CacheOptions options,
+	                  std::shared_ptr<DiskResponseStore> disk = nullptr)
+	    : cache(std::move(cache)), metrics(std::move(metrics)), inner(std::move(inner)), options(std::move(options)),
+	      disk(std::move(disk)) {
+	}
+
+	HttpResponse Execute(const HttpRequest &request) override;
+
+private:
+	// Drive version of the spreadsheet, empty when it can't be read (e.g. the token lacks a Drive scope)
+	std::string GetVersion(const std::string &spreadsheetId, const HttpHeaders &headers);
+	std::string FetchVersion(const std::string &spreadsheetId, const HttpHeaders &headers);
+	void StoreInMemory(const std::string &key, ResponseCache::Entry entry);
+	HttpResponse ExecuteMetadataRead(const HttpRequest &request, const std::string &spreadsheetId);
+
+	std::shared_ptr<ResponseCache> cache;
+	// Declared before the inner clients, which count their requests in the same metrics, so that it outlives them
+	std::shared_ptr<Metrics> metrics;
+	std::unique_ptr<IHttpClient> inner;
+	CacheOptions options;
+	std::shared_ptr<DiskResponseStore> disk;
+
+	std::mutex metadata_lock;
+	// Metadata responses fetched by this client by URL
+	std::map<std::string, HttpResponse> metadata;
+	// Drive versions read by this client by spreadsheet id, empty when the version couldn't be read
+	std::map<std::string, std::string> versions;
+};
+
+// Spreadsheet id in a Sheets API or Visualization API URL, empty for other URLs
+std::string SpreadsheetIdFromUrl(const std::string &url);
+
+// Whether the request reads cell values, the only responses that are cached
+bool IsCacheableRead(const HttpRequest &request);
+
+// Whether the request reads spreadsheet metadata (spreadsheets.get)
+bool IsMetadataRead(const HttpRequest &request);
+
+} // namespace sheets
+} // namespace duckdb
@@ -4,12 +4,33 @@
 
 #include "duckdb/main/client_context.hpp"
 
+#include "sheets/metrics.hpp"
 #include "sheets/transport/http_client.hpp"
+#include "sheets/transport/disk_response_store.hpp"
+#include "sheets/transport/hedging_http_client.hpp"
+#include "sheets/transport/request_scheduler.hpp"
+#include "sheets/transport/response_cache.hpp"
 
 namespace duckdb {
 namespace sheets {
 
+// Creates the client for a query, configured from the current settings
 std::unique_ptr<IHttpClient> CreateHttpClient(ClientContext &ctx);
 
+// Response cache and metrics shared by every connection to the database. They live in the database's object cache,
+// and share ownership of their entry so that they outlive its replacement or eviction.
+std::shared_ptr<ResponseCache> GetResponseCache(ClientContext &ctx);
+std::shared_ptr<Metrics> GetMetrics(ClientContext &ctx);
+// Latencies of recent GETs to the database, from which the hedging delay is derived. Shares ownership of its entry,
+// hedged requests may still record a latency after the statement ended.
+std::shared_ptr<LatencyTracker> GetLatencyTracker(ClientContext &ctx);
+
+// Scheduler shared by every connection to the database, configured from the current settings
+std::shared_ptr<RequestScheduler> GetRequestScheduler(ClientContext &ctx);
+
+// Store of the gsheets_cache_directory setting, created on first use and kept by the database, sharing ownership
+// of its entry like the cache. nullptr when the setting is empty.
+std::shared_ptr<DiskResponseStore> GetDiskResponseStore(ClientContext &ctx);
+
 } // namespace sheets
 } // namespace duckdb
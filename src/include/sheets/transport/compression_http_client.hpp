@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/http_client.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+struct CompressionOptions {
+	// Ask for gzip responses and decode them
+	bool acceptGzip = true;
+	// Send POST and PUT bodies of at least minRequestBytes gzip encoded
+	bool compressRequests = false;
+	size_t minRequestBytes = 1024;
+};
+
+// Gzip encodes request and response bodies, and counts the bytes sent and received before and after encoding. The
+// inner client has to pass encoded bodies through as they are.
+class CompressionHttpClient : public IHttpClient {
+public:
+	CompressionHttpClient(std::unique_ptr<IHttpClient> inner, Metrics &metrics, CompressionOptions options)
+	    : inner(std::move(inner)), metrics(metrics), options(options) {
+	}
+
+	HttpResponse Execute(const HttpRequest &request) override;
+
+private:
+	std::unique_ptr<IHttpClient> inner;
+	Metrics &metrics;
+	CompressionOptions options;
+};
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <future>
+#include <memory>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/http_client.hpp"
+#include "sheets/transport/http_type.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+class CurlMultiLoop;
+
+struct CurlOptions {
+	// Negotiate HTTP/2 over TLS and multiplex requests to a host over one connection, falling back to HTTP/1.1
+	bool http2 = true;
+};
+
+// Sends requests with libcurl's multi interface. Every client hands its transfers to one event loop thread shared by
+// the process, whose connection pool, DNS cache and TLS sessions are reused by all statements. With HTTP/2 many
+// in-flight requests share a single connection. ExecuteAsync doesn't take a thread per request.
+// Only built with -DGSHEETS_CURL_TRANSPORT=ON, which defines GSHEETS_HAS_CURL.
+class CurlHttpClient : public IHttpClient {
+public:
+	explicit CurlHttpClient(HttpProxyConfig proxy_config, CurlOptions options = CurlOptions(),
+	                        std::shared_ptr<Metrics> metrics = nullptr, HttpTimeouts timeouts = HttpTimeouts());
+
+	HttpResponse Execute(const HttpRequest &request) override;
+	std::future<HttpResponse> ExecuteAsync(const HttpRequest &request) override;
+
+private:
+	HttpProxyConfig proxy_config;
+	CurlOptions options;
+	std::shared_ptr<Metrics> metrics;
+	HttpTimeouts timeouts;
+	std::shared_ptr<CurlMultiLoop> loop;
+};
+
+} // namespace sheets
+} // namespace duckdb
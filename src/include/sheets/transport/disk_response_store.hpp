@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "sheets/transport/response_cache.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+constexpr size_t DEFAULT_DISK_CACHE_MAX_BYTES = 1024 * 1024 * 1024;
+
+// Responses kept in a directory so that they outlive the process. Each response is one file, named after the
+// spreadsheet and a hash of its key, and an index file records the size and last use of each so that the least
+// recently used files are evicted once the directory exceeds its byte budget. Loads only update the last use in
+// memory, it is written with the next change to the index or when the store is destroyed. The directory must exist
+// and should only be used by one database at a time.
+class DiskResponseStore {
+public:
+	DiskResponseStore(std::string directory, size_t maxBytes = DEFAULT_DISK_CACHE_MAX_BYTES)
+	    : directory(std::move(directory)), maxBytes(maxBytes) {
+	}
+	~DiskResponseStore();
+
+	bool Load(const std::string &key, const std::string &spreadsheetId, ResponseCache::Entry &entry);
+	// Returns the number of files evicted to make room
+	size_t Store(const std::string &key, const ResponseCache::Entry &entry);
+	void RemoveSpreadsheet(const std::string &spreadsheetId);
+	// Returns the number of files removed
+	size_t Clear();
+
+	// Returns the number of files evicted to fit the new budget
+	size_t SetMaxBytes(size_t maxBytes);
+	size_t FileCount();
+	size_t ByteCount();
+
+	const std::string &GetDirectory() const {
+		return directory;
+	}
+
+private:
+	struct File {
+		std::string spreadsheetId;
+		size_t size;
+		uint64_t lastUse;
+	};
+
+	std::string Path(const std::string &name) const;
+	void LoadIndex();
+	void SaveIndex();
+	void RemoveFile(std::map<std::string, File>::iterator file);
+	size_t EvictToBudget();
+
+	std::mutex lock;
+	std::string directory;
+	size_t maxBytes;
+	bool indexLoaded = false;
+	// Whether the last use of a file changed since the index was saved
+	bool indexDirty = false;
+	size_t bytes = 0;
+	// Increases with every load and store, persisted through the index
+	uint64_t useCounter = 0;
+	std::map<std::string, File> files;
+};
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,25 +1,49 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "sheets/metrics.hpp"
 #include "sheets/transport/http_client.hpp"
 
 // Forward declarations
 namespace duckdb {
 class DatabaseInstance;
 class ClientContext;
+class HTTPClient;
+class HTTPUtil;
+struct HTTPParams;
 } // namespace duckdb
 
 namespace duckdb {
 namespace sheets {
 
-// This client will use DuckDB's built-in HTTPUtil once it supports POST/PUT.
-// Currently HTTPUtil::Post throws NotImplementedException.
-
+// Sends requests through the HTTPUtil of the database (the core httplib client, or httpfs's when it is loaded), so
+// that DuckDB's HTTP settings (http_timeout, http_keep_alive, http_proxy and the http secret) and HTTP logging apply.
+// Clients are kept per host and reused between requests. Retries are left to RetryHttpClient.
 class DuckDBHttpClient : public IHttpClient {
 public:
-	explicit DuckDBHttpClient(DatabaseInstance &db);
-	explicit DuckDBHttpClient(ClientContext &context);
+	explicit DuckDBHttpClient(DatabaseInstance &db, std::shared_ptr<Metrics> metrics = nullptr);
+	explicit DuckDBHttpClient(ClientContext &context, std::shared_ptr<Metrics> metrics = nullptr);
+	~DuckDBHttpClient() override;
 
 	HttpResponse Execute(const HttpRequest &request) override;
+
+private:
+	std::unique_ptr<HTTPClient> Acquire(const std::string &protoHostPort);
+	void Release(const std::string &protoHostPort, std::unique_ptr<HTTPClient> client);
+	void Count(const char *metric);
+
+	HTTPUtil &http_util;
+	// Read when the client is created, shared by every request
+	std::unique_ptr<HTTPParams> params;
+	std::shared_ptr<Metrics> metrics;
+
+	std::mutex pool_lock;
+	std::map<std::string, std::vector<std::unique_ptr<HTTPClient>>> idle;
 };
 
 } // namespace sheets
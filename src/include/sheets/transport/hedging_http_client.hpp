@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/http_client.hpp"
+#include "sheets/transport/request_scheduler.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Latencies of recent requests, shared by the clients of a database so that the hedging delay reflects more than
+// one statement. Also counts the GETs and hedges in flight, so that hedges can be capped at a fraction of the GETs.
+class LatencyTracker {
+public:
+	explicit LatencyTracker(size_t capacity = 256) : capacity(capacity) {
+	}
+
+	void Record(std::chrono::milliseconds latency);
+	size_t Count() const;
+	// Latency below which the fraction of the recorded requests completed, 0 when none were recorded
+	std::chrono::milliseconds Percentile(double fraction) const;
+
+	void BeginRequest();
+	void EndRequest();
+	// Returns false when maxFraction of the GETs in flight (and at least one) are hedges already
+	bool TryBeginHedge(double maxFraction);
+	void EndHedge();
+
+private:
+	mutable std::mutex lock;
+	size_t capacity;
+	// Ring buffer of the last capacity latencies
+	std::vector<std::chrono::milliseconds> samples;
+	size_t next = 0;
+	size_t requestsInFlight = 0;
+	size_t hedgesInFlight = 0;
+};
+
+struct HedgingOptions {
+	// Percentile of recent latencies after which a GET is sent a second time
+	double percentile = 0.95;
+	// Latencies recorded before any request is hedged
+	size_t minSamples = 20;
+	// Bounds of the delay, so that fast responses aren't duplicated and stalls are hedged eventually
+	std::chrono::milliseconds minDelay {50};
+	std::chrono::milliseconds maxDelay {std::chrono::seconds(10)};
+	// Hedges in flight as a fraction of the GETs in flight, so that hedges don't add to the load that slows requests
+	// down. One hedge is always allowed.
+	double maxHedgeFraction = 0.1;
+};
+
+// Sends a second copy of a GET that takes longer than most, and returns whichever response comes first. The other
+// request is cancelled. Latencies are measured from when a copy is sent by the inner client, not from when it was
+// queued, and the latency of the copy that answered is recorded. Requests other than GETs are passed through.
+//
+// Sits below the SchedulingHttpClient, so that the time requests wait for their turn doesn't count as latency. A
+// hedge is only sent when the scheduler admits it right away, hedges never wait for quota or a free slot.
+class HedgingHttpClient : public IHttpClient {
+public:
+	HedgingHttpClient(std::unique_ptr<IHttpClient> inner, std::shared_ptr<LatencyTracker> latencies, Metrics &metrics,
+	                  HedgingOptions options = HedgingOptions(), std::shared_ptr<RequestScheduler> scheduler = nullptr)
+	    : inner(std::move(inner)), latencies(std::move(latencies)), metrics(metrics), options(options),
+	      scheduler(std::move(scheduler)) {
+	}
+	// Waits for cancelled requests, they use the inner client
+	~HedgingHttpClient() override;
+
+	HttpResponse Execute(const HttpRequest &request) override;
+
+private:
+	struct Race;
+
+	void Launch(const HttpRequest &request, const std::shared_ptr<Race> &race, bool hedge);
+
+	std::unique_ptr<IHttpClient> inner;
+	// Shared with the legs, which run on the executor's threads
+	std::shared_ptr<LatencyTracker> latencies;
+	Metrics &metrics;
+	HedgingOptions options;
+	// Admits the hedges, null when they aren't scheduled
+	std::shared_ptr<RequestScheduler> scheduler;
+
+	std::mutex legs_lock;
+	std::condition_variable legs_finished;
+	// Copies sent and not finished yet, including cancelled ones
+	size_t running_legs = 0;
+};
+
+} // namespace sheets
+} // namespace duckdb
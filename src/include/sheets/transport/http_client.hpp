@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+
 #include "sheets/transport/http_type.hpp"
 
 namespace duckdb {
@@ -9,6 +11,9 @@ class IHttpClient {
 public:
 	virtual ~IHttpClient() = default;
 	virtual HttpResponse Execute(const HttpRequest &request) = 0;
+	// Sends the request without waiting for the response. By default Execute runs on the DefaultHttpExecutor.
+	// The client has to outlive the returned future.
+	virtual std::future<HttpResponse> ExecuteAsync(const HttpRequest &request);
 
 	HttpRequest BuildRequest(const HttpMethod method, const std::string &url, const HttpHeaders &headers);
 	HttpRequest BuildRequest(const HttpMethod method, const std::string &url, const HttpHeaders &headers,
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sheets/transport/http_type.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+constexpr size_t DEFAULT_HTTP_EXECUTOR_THREADS = 8;
+
+// Runs blocking requests on a small pool of threads of its own, so that requests can be kept in flight without
+// tying up the threads of the caller (e.g. DuckDB's scheduler). Threads are started as requests are queued.
+class HttpExecutor {
+public:
+	explicit HttpExecutor(size_t maxThreads = DEFAULT_HTTP_EXECUTOR_THREADS) : maxThreads(maxThreads) {
+	}
+	~HttpExecutor();
+
+	HttpExecutor(const HttpExecutor &) = delete;
+	HttpExecutor &operator=(const HttpExecutor &) = delete;
+
+	std::future<HttpResponse> Submit(std::function<HttpResponse()> task);
+
+private:
+	void Work();
+
+	std::mutex lock;
+	std::condition_variable queued;
+	std::deque<std::packaged_task<HttpResponse()>> tasks;
+	std::vector<std::thread> threads;
+	size_t maxThreads;
+	size_t idleThreads = 0;
+	bool stopping = false;
+};
+
+// Executor shared by every client
+HttpExecutor &DefaultHttpExecutor();
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <map>
 
@@ -16,6 +19,9 @@ struct HttpRequest {
 	std::string url;
 	HttpHeaders headers;
 	std::string body;
+	// Set to abandon the request, e.g. the slower of two hedged requests. Transports that support it stop waiting for
+	// the response; null when the request can't be cancelled.
+	std::shared_ptr<std::atomic<bool>> cancelled;
 };
 
 struct HttpResponse {
@@ -24,6 +30,14 @@ struct HttpResponse {
 	std::string body;
 };
 
+struct HttpTimeouts {
+	std::chrono::milliseconds connect {std::chrono::seconds(10)};
+	// Longest time without receiving data while waiting for the response
+	std::chrono::milliseconds read {std::chrono::seconds(60)};
+	// Whole request including the response body, 0 for no limit
+	std::chrono::milliseconds total {std::chrono::seconds(300)};
+};
+
 struct HttpProxyConfig {
 	std::string host;
 	uint16_t port = 0;
@@ -1,24 +1,69 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "sheets/metrics.hpp"
 #include "sheets/transport/http_client.hpp"
 #include "sheets/transport/http_type.hpp"
 
+namespace duckdb_httplib_openssl {
+class Client;
+} // namespace duckdb_httplib_openssl
+
 namespace duckdb {
 namespace sheets {
 
+struct ConnectionPoolOptions {
+	// Keep connections open between requests, otherwise every request opens a new connection
+	bool keepAlive = true;
+	// Idle connections older than this are closed rather than reused
+	std::chrono::milliseconds idleTimeout {std::chrono::seconds(30)};
+	// Idle connections kept per host, more are opened while requests run concurrently
+	size_t maxIdlePerHost = 8;
+};
+
+// Sends requests with cpp-httplib. Connections are kept alive in a pool per host, so that a statement's requests
+// reuse a few TLS connections instead of handshaking for every request. Safe for concurrent use: each request
+// takes a connection out of the pool and puts it back once done. httplib only times out single reads and writes, so
+// a watchdog thread of the client stops requests of any method past the total timeout or once they are cancelled.
 class HttpLibClient : public IHttpClient {
 public:
-	explicit HttpLibClient(HttpProxyConfig proxy_config) : proxy_config(std::move(proxy_config)) {
-	}
+	explicit HttpLibClient(HttpProxyConfig proxy_config, ConnectionPoolOptions pool_options = ConnectionPoolOptions(),
+	                       std::shared_ptr<Metrics> metrics = nullptr, HttpTimeouts timeouts = HttpTimeouts());
+	~HttpLibClient() override;
 
 	HttpResponse Execute(const HttpRequest &request) override;
 
 private:
+	class Watchdog;
+
+	struct Connection {
+		std::unique_ptr<duckdb_httplib_openssl::Client> client;
+		std::chrono::steady_clock::time_point lastUsed;
+	};
+
 	void ParseUrl(const std::string &url, std::string &baseUrl, std::string &path);
+	std::unique_ptr<Connection> Acquire(const std::string &baseUrl);
+	void Release(const std::string &baseUrl, std::unique_ptr<Connection> connection);
+	void Count(const char *metric, int64_t delta = 1);
 
 	HttpProxyConfig proxy_config;
+	ConnectionPoolOptions pool_options;
+	std::shared_ptr<Metrics> metrics;
+	HttpTimeouts timeouts;
+
+	std::unique_ptr<Watchdog> watchdog;
+
+	std::mutex pool_lock;
+	// Idle connections by base URL, most recently used last
+	std::map<std::string, std::vector<std::unique_ptr<Connection>>> idle;
 };
 } // namespace sheets
 } // namespace duckdb
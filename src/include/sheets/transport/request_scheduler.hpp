@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/http_client.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Quota a request counts against. Reads go before writes when both wait.
+enum class RequestClass { READ, WRITE, UNMETERED };
+
+// READ for Sheets API GETs, WRITE for other Sheets API requests, UNMETERED for other APIs (tokens, Drive)
+RequestClass ClassifyRequest(const HttpRequest &request);
+
+struct SchedulerOptions {
+	// Requests per minute against each Sheets API quota, 0 for no limit
+	int64_t readsPerMinute = 300;
+	int64_t writesPerMinute = 300;
+	// Seconds of quota that can be spent at once after a quiet period
+	int64_t burstSeconds = 10;
+	// Requests sent at the same time, 0 for no limit
+	size_t maxInFlight = 16;
+};
+
+// Requests per minute, refilled continuously and spent one token per request
+class TokenBucket {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	void Configure(int64_t perMinute, int64_t burstSeconds, Clock::time_point now);
+	bool Unlimited() const {
+		return perMinute <= 0;
+	}
+	// Whether a token is available at now, adding the tokens refilled since the last call
+	bool Ready(Clock::time_point now);
+	void Take();
+	// Time until the next token is available
+	std::chrono::microseconds UntilReady() const;
+
+private:
+	bool configured = false;
+	int64_t perMinute = 0;
+	double capacity = 0;
+	double tokens = 0;
+	Clock::time_point refilled;
+};
+
+// Admits the requests of every connection to a database, so that together they stay within the project's per-minute
+// quotas and a maximum number of requests in flight. Waiting requests are admitted in order within their class.
+class RequestScheduler {
+public:
+	explicit RequestScheduler(SchedulerOptions options = SchedulerOptions());
+
+	// Applies new settings, requests already waiting are admitted under them
+	void Configure(const SchedulerOptions &options);
+	// Blocks until the request may be sent, Release has to be called once it is done
+	void Acquire(RequestClass requestClass);
+	// Admits the request only if it could go right away without overtaking a waiting one
+	bool TryAcquire(RequestClass requestClass);
+	void Release();
+
+	size_t InFlight() const;
+
+private:
+	TokenBucket *Bucket(RequestClass requestClass);
+
+	mutable std::mutex lock;
+	std::condition_variable changed;
+	SchedulerOptions options;
+	TokenBucket reads;
+	TokenBucket writes;
+	size_t inFlight = 0;
+	// Tickets handed out and the ticket admitted next, per class
+	uint64_t nextTicket[3] = {0, 0, 0};
+	uint64_t servingTicket[3] = {0, 0, 0};
+};
+
+// Sends every request through a scheduler shared with the other clients of the database
+class SchedulingHttpClient : public IHttpClient {
+public:
+	SchedulingHttpClient(std::unique_ptr<IHttpClient> inner, std::shared_ptr<RequestScheduler> scheduler,
+	                     Metrics &metrics)
+	    : inner(std::move(inner)), scheduler(std::move(scheduler)), metrics(metrics) {
+	}
+
+	HttpResponse Execute(const HttpRequest &request) override;
+
+private:
+	std::unique_ptr<IHttpClient> inner;
+	std::shared_ptr<RequestScheduler> scheduler;
+	Metrics &metrics;
+};
+
+} // namespace sheets
+} // namespace duckdb
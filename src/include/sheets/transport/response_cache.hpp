@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "sheets/transport/http_type.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+constexpr size_t DEFAULT_CACHE_MAX_BYTES = 256 * 1024 * 1024;
+
+// Responses of read requests shared between clients. Entries are evicted least recently used first once the
+// cached keys and bodies exceed the byte budget.
+class ResponseCache {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		HttpResponse response;
+		// Spreadsheet the response was read from, used to drop it after a write
+		std::string spreadsheetId;
+		// Drive version of the spreadsheet when the response was fetched, empty if it wasn't validated
+		std::string version;
+		Clock::time_point storedAt;
+	};
+
+	explicit ResponseCache(size_t maxBytes = DEFAULT_CACHE_MAX_BYTES) : maxBytes(maxBytes) {
+	}
+
+	// Copies the entry stored under key and marks it as recently used
+	bool Get(const std::string &key, Entry &entry);
+	// Returns the number of entries evicted to make room. Entries larger than the budget aren't stored.
+	size_t Put(const std::string &key, Entry entry);
+	void Remove(const std::string &key);
+	void RemoveSpreadsheet(const std::string &spreadsheetId);
+	// Returns the number of entries removed
+	size_t Clear();
+
+	// Remembers that the Drive version of a spreadsheet can't be read with some credentials (e.g. the token lacks a
+	// Drive scope), so that it isn't asked for again until the cache is cleared
+	void MarkUnversioned(const std::string &key);
+	bool IsUnversioned(const std::string &key) const;
+
+	// Returns the number of entries evicted to fit the new budget
+	size_t SetMaxBytes(size_t maxBytes);
+	size_t EntryCount() const;
+	size_t ByteCount() const;
+
+private:
+	struct Slot {
+		Entry entry;
+		size_t size;
+		std::list<std::string>::iterator position;
+	};
+
+	void RemoveSlot(std::unordered_map<std::string, Slot>::iterator slot);
+	size_t EvictToBudget();
+
+	mutable std::mutex lock;
+	size_t maxBytes;
+	size_t bytes = 0;
+	std::unordered_map<std::string, Slot> slots;
+	// Keys from most to least recently used
+	std::list<std::string> recency;
+	std::unordered_set<std::string> unversioned;
+};
+
+} // namespace sheets
+} // namespace duckdb
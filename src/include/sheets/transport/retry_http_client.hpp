@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+
+#include "sheets/metrics.hpp"
+#include "sheets/transport/http_client.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+struct RetryOptions {
+	// Retries after the first attempt, 0 disables retrying
+	int maxRetries = 5;
+	// Backoff before the first retry, doubled for each later one
+	std::chrono::milliseconds initialBackoff {500};
+	// Longest wait before a retry, also caps the server's Retry-After
+	std::chrono::milliseconds maxBackoff {std::chrono::seconds(64)};
+	// Waits between attempts, replaced by tests
+	std::function<void(std::chrono::milliseconds)> sleep;
+};
+
+// Whether the status is a transient failure: a timeout, a quota or rate limit (429) or a server error
+bool IsRetryableStatus(int statusCode);
+// Whether sending the request twice has the same effect as sending it once. Appends and batchUpdate (e.g. adding a
+// sheet) are not, they are only retried when the server rejected them without applying them (429).
+bool IsIdempotentRequest(const HttpRequest &request);
+// Delay asked for by a Retry-After header in seconds, -1 when there is none or it can't be read
+int64_t RetryAfterMilliseconds(const HttpHeaders &headers);
+
+// Retries transient failures with jittered exponential backoff, honouring Retry-After. Sits on top of the transport
+// so that each attempt goes over the network.
+class RetryHttpClient : public IHttpClient {
+public:
+	RetryHttpClient(std::unique_ptr<IHttpClient> inner, Metrics &metrics, RetryOptions options);
+
+	HttpResponse Execute(const HttpRequest &request) override;
+
+	// Wait before retry number attempt (0 for the first retry) without a Retry-After: a random delay between half
+	// and all of the exponential backoff, so that clients hitting the same quota don't retry in lockstep
+	std::chrono::milliseconds Backoff(int attempt);
+
+private:
+	void Wait(std::chrono::milliseconds delay);
+
+	std::unique_ptr<IHttpClient> inner;
+	Metrics &metrics;
+	RetryOptions options;
+	std::mutex random_lock;
+	std::mt19937_64 random;
+};
+
+} // namespace sheets
+} // namespace duckdb
@@ -5,6 +5,8 @@
 
 #include "json.hpp"
 
+#include "sheets/cell_buffer.hpp"
+
 namespace duckdb {
 namespace sheets {
 
@@ -17,20 +19,62 @@ NLOHMANN_JSON_SERIALIZE_ENUM(SheetType, {
                                             {DATA_SOURCE, "DATA_SOURCE"},
                                         })
 
+struct GridProperties {
+	int rowCount = 0;
+	int columnCount = 0;
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(GridProperties, rowCount, columnCount)
+
 struct SheetMetadataProperties {
 	int sheetId = 0;
 	std::string title = "";
 	int index = 0;
 	SheetType sheetType = SHEET_TYPE_UNSPECIFIED;
+	GridProperties gridProperties = {};
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(SheetMetadataProperties, sheetId, title, index, sheetType,
+                                                gridProperties)
+
+struct NumberFormat {
+	// e.g. "NUMBER", "CURRENCY", "DATE", "TIME" or "DATE_TIME"
+	std::string type = "";
 };
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(SheetMetadataProperties, sheetId, title, index, sheetType)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(NumberFormat, type)
+
+struct CellFormat {
+	NumberFormat numberFormat = {};
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(CellFormat, numberFormat)
+
+struct CellData {
+	CellFormat effectiveFormat = {};
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(CellData, effectiveFormat)
+
+struct RowData {
+	std::vector<CellData> values = {};
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(RowData, values)
+
+struct GridData {
+	std::vector<RowData> rowData = {};
+};
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(GridData, rowData)
 
 struct SheetMetadata {
 	SheetMetadataProperties properties = {};
+	// Only returned when grid data is requested for a range
+	std::vector<GridData> data = {};
 };
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(SheetMetadata, properties)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(SheetMetadata, properties, data)
 
 struct SpreadsheetMetadataProperties {
 	std::string title = "";
@@ -100,6 +144,20 @@ struct ValueRange {
 
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ValueRange, range, majorDimension, values)
 
+enum ValueRenderOption { FORMATTED_VALUE, UNFORMATTED_VALUE };
+
+// A ValueRange read with typed cells, decoded by DecodeCellRange
+struct CellRange {
+	std::string range = "";
+	MajorDimension majorDimension = ROWS;
+	CellBuffer values;
+};
+
+struct BatchGetCellsResponse {
+	std::string spreadsheetId = "";
+	std::vector<CellRange> valueRanges = {};
+};
+
 struct UpdateValuesResponse {
 	std::string spreadsheetId = "";
 	std::string updatedRange = "";
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+#include "sheets/types.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Decode values responses straight into typed cells with a SAX parser, so no JSON document is built for the
+// (possibly very large) values array. Unknown keys are skipped. Throws SheetsParseException on invalid JSON.
+CellRange DecodeCellRange(const std::string &body);
+BatchGetCellsResponse DecodeBatchGetCells(const std::string &body);
+
+} // namespace sheets
+} // namespace duckdb
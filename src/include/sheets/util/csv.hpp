@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace duckdb {
+namespace sheets {
+
+// Parses RFC 4180 CSV text into rows of fields. Quoted fields may contain separators, line breaks and
+// doubled quotes. Throws SheetsParseException on an unterminated quoted field.
+std::vector<std::vector<std::string>> ParseCsv(const std::string &text);
+
+} // namespace sheets
+} // namespace duckdb
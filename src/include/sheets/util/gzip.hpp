@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace duckdb {
+namespace sheets {
+
+// Compresses data into the gzip format
+std::string GzipCompress(const std::string &data);
+
+// Decompresses gzip (or zlib) data. Throws SheetsParseException on corrupt or truncated data.
+std::string GzipDecompress(const std::string &data);
+
+} // namespace sheets
+} // namespace duckdb
@@ -8,11 +8,15 @@
 namespace duckdb {
 namespace sheets {
 
-template <typename T>
-T ParseResponse(const HttpResponse &response) {
+inline void CheckResponse(const HttpResponse &response) {
 	if (response.statusCode != 200) {
 		throw SheetsApiException(response.statusCode, response.body);
 	}
+}
+
+template <typename T>
+T ParseResponse(const HttpResponse &response) {
+	CheckResponse(response);
 	try {
 		return nlohmann::json::parse(response.body).get<T>();
 	} catch (const nlohmann::json::exception &e) {
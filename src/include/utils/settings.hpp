@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Maximum number of requests a single read_gsheet scan keeps in flight
+constexpr const char *MAX_CONCURRENCY_SETTING = "gsheets_max_concurrency";
+constexpr int64_t DEFAULT_MAX_CONCURRENCY = 4;
+
+// Seconds a cell value response is served from the shared response cache, 0 disables the cache
+constexpr const char *CACHE_TTL_SETTING = "gsheets_cache_ttl";
+constexpr int64_t DEFAULT_CACHE_TTL = 0;
+// Seconds spreadsheet metadata (sheet names, ids and sizes) is reused across statements, 0 to only reuse it within
+// a statement
+constexpr const char *METADATA_CACHE_TTL_SETTING = "gsheets_metadata_cache_ttl";
+constexpr int64_t DEFAULT_METADATA_CACHE_TTL = 5;
+// Byte budget of the shared response cache
+constexpr const char *CACHE_MAX_BYTES_SETTING = "gsheets_cache_max_bytes";
+// Whether cached responses are checked against the spreadsheet's Drive version before being served
+constexpr const char *CACHE_VALIDATE_SETTING = "gsheets_cache_validate";
+// Directory where responses are kept across restarts, empty to keep them in memory only
+constexpr const char *CACHE_DIRECTORY_SETTING = "gsheets_cache_directory";
+// Byte budget of the cache directory
+constexpr const char *CACHE_DIRECTORY_MAX_BYTES_SETTING = "gsheets_cache_directory_max_bytes";
+
+// Whether responses are requested gzip encoded
+constexpr const char *HTTP_COMPRESSION_SETTING = "gsheets_http_compression";
+// Whether request bodies (e.g. COPY TO) are sent gzip encoded
+constexpr const char *COMPRESS_REQUESTS_SETTING = "gsheets_compress_requests";
+
+// Transport sending the requests: "httplib" for the extension's own client, "duckdb" for DuckDB's HTTPUtil, "curl"
+// for libcurl with HTTP/2
+constexpr const char *HTTP_CLIENT_SETTING = "gsheets_http_client";
+constexpr const char *DEFAULT_HTTP_CLIENT = "httplib";
+
+// Whether connections are kept open and reused between requests
+constexpr const char *HTTP_KEEP_ALIVE_SETTING = "gsheets_http_keep_alive";
+// Seconds an idle connection is kept for reuse
+constexpr const char *HTTP_IDLE_TIMEOUT_SETTING = "gsheets_http_idle_timeout";
+constexpr int64_t DEFAULT_HTTP_IDLE_TIMEOUT = 30;
+
+// Seconds to open a connection, to wait for data while reading a response, and for a whole request (0 for no limit).
+// The DuckDB transport uses DuckDB's http_timeout instead.
+constexpr const char *HTTP_CONNECT_TIMEOUT_SETTING = "gsheets_http_connect_timeout";
+constexpr int64_t DEFAULT_HTTP_CONNECT_TIMEOUT = 10;
+constexpr const char *HTTP_READ_TIMEOUT_SETTING = "gsheets_http_read_timeout";
+constexpr int64_t DEFAULT_HTTP_READ_TIMEOUT = 60;
+constexpr const char *HTTP_TIMEOUT_SETTING = "gsheets_http_timeout";
+constexpr int64_t DEFAULT_HTTP_TIMEOUT = 300;
+// Whether GETs slower than the 95th percentile of recent ones are sent a second time
+constexpr const char *HTTP_HEDGING_SETTING = "gsheets_http_hedging";
+
+// Retries of a request failing with a timeout, rate limit or server error, 0 disables retrying
+constexpr const char *HTTP_RETRIES_SETTING = "gsheets_http_retries";
+constexpr int64_t DEFAULT_HTTP_RETRIES = 5;
+// Longest wait in seconds before a retry, also caps the server's Retry-After
+constexpr const char *HTTP_RETRY_MAX_WAIT_SETTING = "gsheets_http_retry_max_wait";
+constexpr int64_t DEFAULT_HTTP_RETRY_MAX_WAIT = 64;
+
+// Requests per minute every connection of the database together sends against the Sheets read and write quotas,
+// 0 for no limit
+constexpr const char *READ_REQUESTS_PER_MINUTE_SETTING = "gsheets_read_requests_per_minute";
+constexpr int64_t DEFAULT_READ_REQUESTS_PER_MINUTE = 300;
+constexpr const char *WRITE_REQUESTS_PER_MINUTE_SETTING = "gsheets_write_requests_per_minute";
+constexpr int64_t DEFAULT_WRITE_REQUESTS_PER_MINUTE = 300;
+// Requests every connection of the database together keeps in flight, 0 for no limit
+constexpr const char *MAX_REQUESTS_IN_FLIGHT_SETTING = "gsheets_max_requests_in_flight";
+constexpr int64_t DEFAULT_MAX_REQUESTS_IN_FLIGHT = 16;
+
+void RegisterSettings(DBConfig &config);
+
+int64_t GetBigintSetting(ClientContext &ctx, const std::string &name, int64_t default_value);
+
+bool GetBooleanSetting(ClientContext &ctx, const std::string &name, bool default_value);
+
+std::string GetStringSetting(ClientContext &ctx, const std::string &name, const std::string &default_value);
+
+} // namespace sheets
+} // namespace duckdb
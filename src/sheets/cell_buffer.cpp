@@ -0,0 +1,147 @@
+#include "sheets/cell_buffer.hpp"
+#include "sheets/exception.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+void CellBuffer::AddLine() {
+	line_starts.push_back(entries.size());
+}
+
+void CellBuffer::AddEntry(const Entry &entry) {
+	if (line_starts.size() == first_line) {
+		AddLine();
+	}
+	entries.push_back(entry);
+}
+
+void CellBuffer::AddString(const char *data, size_t size) {
+	if (size == 0) {
+		AddEmpty();
+		return;
+	}
+	if (size > UINT32_MAX) {
+		throw SheetsParseException("Cell text of " + std::to_string(size) + " bytes is too long");
+	}
+	Entry entry;
+	entry.kind = CellValue::Kind::STRING;
+	entry.size = static_cast<uint32_t>(size);
+	entry.offset = arena.size();
+	arena.insert(arena.end(), data, data + size);
+	AddEntry(entry);
+}
+
+void CellBuffer::AddNumber(double number) {
+	Entry entry;
+	entry.kind = CellValue::Kind::NUMBER;
+	entry.size = 0;
+	entry.number = number;
+	AddEntry(entry);
+}
+
+void CellBuffer::AddBoolean(bool value) {
+	Entry entry;
+	entry.kind = CellValue::Kind::BOOLEAN;
+	entry.size = 0;
+	entry.number = value ? 1 : 0;
+	AddEntry(entry);
+}
+
+void CellBuffer::AddEmpty() {
+	Entry entry;
+	entry.kind = CellValue::Kind::EMPTY;
+	entry.size = 0;
+	entry.offset = 0;
+	AddEntry(entry);
+}
+
+void CellBuffer::AddCell(const CellValue &cell) {
+	switch (cell.kind) {
+	case CellValue::Kind::STRING:
+		AddString(cell.data, cell.size);
+		break;
+	case CellValue::Kind::NUMBER:
+		AddNumber(cell.number);
+		break;
+	case CellValue::Kind::BOOLEAN:
+		AddBoolean(cell.number != 0);
+		break;
+	default:
+		AddEmpty();
+		break;
+	}
+}
+
+void CellBuffer::AppendLines(const CellBuffer &other) {
+	uint64_t arena_offset = arena.size();
+	arena.insert(arena.end(), other.arena.begin(), other.arena.end());
+	for (size_t line = other.first_line; line < other.line_starts.size(); line++) {
+		line_starts.push_back(entries.size());
+		size_t end = line + 1 < other.line_starts.size() ? other.line_starts[line + 1] : other.entries.size();
+		for (size_t i = other.line_starts[line]; i < end; i++) {
+			Entry entry = other.entries[i];
+			if (entry.kind == CellValue::Kind::STRING) {
+				entry.offset += arena_offset;
+			}
+			entries.push_back(entry);
+		}
+	}
+}
+
+void CellBuffer::RemoveFirstLines(size_t count) {
+	first_line += count < LineCount() ? count : LineCount();
+}
+
+void CellBuffer::Truncate(size_t count) {
+	if (count >= LineCount()) {
+		return;
+	}
+	size_t line_end = first_line + count;
+	entries.resize(line_starts[line_end]);
+	line_starts.resize(line_end);
+}
+
+void CellBuffer::Clear() {
+	std::vector<char>().swap(arena);
+	std::vector<Entry>().swap(entries);
+	std::vector<size_t>().swap(line_starts);
+	first_line = 0;
+}
+
+void CellBuffer::ShrinkToFit() {
+	arena.shrink_to_fit();
+	entries.shrink_to_fit();
+	line_starts.shrink_to_fit();
+}
+
+size_t CellBuffer::LineSize(size_t line) const {
+	line += first_line;
+	if (line >= line_starts.size()) {
+		return 0;
+	}
+	size_t end = line + 1 < line_starts.size() ? line_starts[line + 1] : entries.size();
+	return end - line_starts[line];
+}
+
+CellValue CellBuffer::Get(size_t line, size_t index) const {
+	CellValue cell;
+	if (index >= LineSize(line)) {
+		return cell;
+	}
+	const auto &entry = entries[line_starts[first_line + line] + index];
+	cell.kind = entry.kind;
+	if (entry.kind == CellValue::Kind::STRING) {
+		cell.data = arena.data() + entry.offset;
+		cell.size = entry.size;
+	} else if (entry.kind != CellValue::Kind::EMPTY) {
+		cell.number = entry.number;
+	}
+	return cell;
+}
+
+size_t CellBuffer::MemoryUsage() const {
+	return arena.capacity() + entries.capacity() * sizeof(Entry) + line_starts.capacity() * sizeof(size_t);
+}
+
+} // namespace sheets
+} // namespace duckdb
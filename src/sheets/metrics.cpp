@@ -0,0 +1,28 @@
+#include "sheets/metrics.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+void Metrics::Increment(const std::string &name, int64_t delta) {
+	std::lock_guard<std::mutex> guard(lock);
+	counters[name] += delta;
+}
+
+int64_t Metrics::Get(const std::string &name) const {
+	std::lock_guard<std::mutex> guard(lock);
+	auto entry = counters.find(name);
+	return entry == counters.end() ? 0 : entry->second;
+}
+
+std::vector<std::pair<std::string, int64_t>> Metrics::Snapshot() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return std::vector<std::pair<std::string, int64_t>>(counters.begin(), counters.end());
+}
+
+void Metrics::Reset() {
+	std::lock_guard<std::mutex> guard(lock);
+	counters.clear();
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,3 +1,6 @@
+#include <cctype>
+#include <utility>
+
 #include "sheets/range.hpp"
 
 namespace duckdb {
@@ -155,5 +158,99 @@ bool A1Range::IsValid() {
 	return state == COL || state == ROW || state == SHEET_NAME_COMPLETE;
 }
 
+int ColumnLettersToIndex(const std::string &letters) {
+	int index = 0;
+	for (char c : letters) {
+		index = index * 26 + (std::toupper(static_cast<unsigned char>(c)) - 'A' + 1);
+	}
+	return index;
+}
+
+std::string ColumnIndexToLetters(int index) {
+	std::string letters;
+	while (index > 0) {
+		int rem = (index - 1) % 26;
+		letters.insert(letters.begin(), static_cast<char>('A' + rem));
+		index = (index - 1) / 26;
+	}
+	return letters;
+}
+
+// Parses one side of a range ("B12", "B", "12") into a column index and row number
+static bool ParseCellReference(const std::string &ref, int &column, int &row) {
+	std::string letters;
+	std::string digits;
+	for (char c : ref) {
+		if (c == '$') {
+			continue;
+		}
+		if (std::isalpha(static_cast<unsigned char>(c)) && digits.empty()) {
+			letters += c;
+		} else if (std::isdigit(static_cast<unsigned char>(c))) {
+			digits += c;
+		} else {
+			return false;
+		}
+	}
+	if (letters.empty() && digits.empty()) {
+		return false;
+	}
+	// Guard against overflow, the largest sheet is far below these limits
+	if (letters.size() > 3 || digits.size() > 9) {
+		return false;
+	}
+	column = letters.empty() ? 0 : ColumnLettersToIndex(letters);
+	row = digits.empty() ? 0 : std::stoi(digits);
+	return true;
+}
+
+bool ParseGridBounds(const std::string &cells, GridBounds &bounds) {
+	bounds = GridBounds();
+	if (cells.empty()) {
+		return true;
+	}
+
+	size_t colon = cells.find(':');
+	if (colon == std::string::npos) {
+		// A single cell must have both a column and a row
+		int column, row;
+		if (!ParseCellReference(cells, column, row) || column == 0 || row == 0) {
+			return false;
+		}
+		bounds = {column, row, column, row};
+		return true;
+	}
+
+	int startColumn, startRow, endColumn, endRow;
+	if (!ParseCellReference(cells.substr(0, colon), startColumn, startRow) ||
+	    !ParseCellReference(cells.substr(colon + 1), endColumn, endRow)) {
+		return false;
+	}
+	// Either both sides name a column ("A2:C", "A:C") or neither does ("2:10")
+	if ((startColumn == 0) != (endColumn == 0)) {
+		return false;
+	}
+	if (startColumn == 0 && (startRow == 0 || endRow == 0)) {
+		return false;
+	}
+	// Sheets accepts reversed corners such as "C7:A2", normalise them
+	if (endColumn > 0 && startColumn > endColumn) {
+		std::swap(startColumn, endColumn);
+	}
+	if (endRow > 0 && startRow > endRow) {
+		std::swap(startRow, endRow);
+	}
+	bounds = {startColumn, startRow, endColumn, endRow};
+	return true;
+}
+
+std::string FormatRowWindow(const GridBounds &bounds, int firstRow, int lastRow) {
+	if (!bounds.HasColumns()) {
+		return std::to_string(firstRow) + ":" + std::to_string(lastRow);
+	}
+	return ColumnIndexToLetters(bounds.startColumn) + std::to_string(firstRow) + ":" +
+	       ColumnIndexToLetters(bounds.endColumn) + std::to_string(lastRow);
+}
+
 } // namespace sheets
 } // namespace duckdb
@@ -21,6 +21,23 @@ HttpResponse BaseResource::DoPost(const std::string &path, const std::string &bo
 	return http.Execute(req);
 }
 
+std::future<HttpResponse> BaseResource::DoGetAsync(const std::string &path) {
+	HttpRequest req;
+	req.url = baseUrl + path;
+	req.method = HttpMethod::GET;
+	req.headers = headers;
+	return http.ExecuteAsync(req);
+}
+
+std::future<HttpResponse> BaseResource::DoPostAsync(const std::string &path, const std::string &body) {
+	HttpRequest req;
+	req.url = baseUrl + path;
+	req.method = HttpMethod::POST;
+	req.headers = headers;
+	req.body = body;
+	return http.ExecuteAsync(req);
+}
+
 HttpResponse BaseResource::DoPut(const std::string &path, const std::string &body) {
 	HttpRequest req;
 	req.url = baseUrl + path;
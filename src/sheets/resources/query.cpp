@@ -0,0 +1,28 @@
+#include "sheets/resources/query.hpp"
+#include "sheets/exception.hpp"
+#include "sheets/util/csv.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+std::vector<std::vector<std::string>> QueryResource::Run(const std::string &sheet, const std::string &range,
+                                                         int headers, const std::string &query) {
+	std::string path = "/" + spreadsheetId + "/gviz/tq?tqx=out:csv&sheet=" + sheet;
+	if (!range.empty()) {
+		path += "&range=" + range;
+	}
+	path += "&headers=" + std::to_string(headers) + "&tq=" + query;
+
+	auto response = DoGet(path);
+	if (response.statusCode != 200) {
+		throw SheetsApiException(response.statusCode, response.body);
+	}
+	// Invalid queries and sign-in redirects come back as HTML pages, CSV fields are always quoted
+	if (!response.body.empty() && response.body[0] == '<') {
+		throw SheetsApiException(response.statusCode, "Unexpected HTML response from the query endpoint");
+	}
+	return ParseCsv(response.body);
+}
+
+} // namespace sheets
+} // namespace duckdb
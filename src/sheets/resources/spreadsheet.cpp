@@ -13,13 +13,23 @@ using json = nlohmann::json;
 namespace duckdb {
 namespace sheets {
 
+// Fields read by Get(), leaving out cell data such as named ranges, merges and conditional formats
+static const char *METADATA_FIELDS = "spreadsheetId,properties(title,locale,timeZone),sheets.properties";
+
 SpreadsheetMetadata SpreadsheetResource::Get() {
-	std::string path = "/spreadsheets/" + spreadsheetId;
+	std::string path = "/spreadsheets/" + spreadsheetId + "?fields=" + METADATA_FIELDS;
 	return ParseResponse<SpreadsheetMetadata>(DoGet(path));
 }
 
-SheetMetadata SpreadsheetResource::GetSheetById(const int sheetId) {
-	auto meta = Get();
+std::future<SpreadsheetMetadata> SpreadsheetResource::GetAsync() {
+	std::string path = "/spreadsheets/" + spreadsheetId + "?fields=" + METADATA_FIELDS;
+	return std::async(
+	    std::launch::deferred,
+	    [](std::future<HttpResponse> response) { return ParseResponse<SpreadsheetMetadata>(response.get()); },
+	    DoGetAsync(path));
+}
+
+SheetMetadata FindSheetById(const SpreadsheetMetadata &meta, int sheetId) {
 	for (const auto &sheet : meta.sheets) {
 		if (sheet.properties.sheetId == sheetId) {
 			return sheet;
@@ -28,6 +38,10 @@ SheetMetadata SpreadsheetResource::GetSheetById(const int sheetId) {
 	throw SheetNotFoundException(std::to_string(sheetId));
 }
 
+SheetMetadata SpreadsheetResource::GetSheetById(const int sheetId) {
+	return FindSheetById(Get(), sheetId);
+}
+
 SheetMetadata SpreadsheetResource::GetSheetById(const std::string &sheetId) {
 	int id = std::stoi(sheetId);
 	return GetSheetById(id);
@@ -43,8 +57,7 @@ SheetMetadata SpreadsheetResource::GetSheetByName(const std::string &name) {
 	throw SheetNotFoundException(name);
 }
 
-SheetMetadata SpreadsheetResource::GetSheetByIndex(const int index) {
-	auto meta = Get();
+SheetMetadata FindSheetByIndex(const SpreadsheetMetadata &meta, int index) {
 	for (const auto &sheet : meta.sheets) {
 		if (sheet.properties.index == index) {
 			return sheet;
@@ -53,6 +66,69 @@ SheetMetadata SpreadsheetResource::GetSheetByIndex(const int index) {
 	throw SheetNotFoundException(std::to_string(index));
 }
 
+SheetMetadata SpreadsheetResource::GetSheetByIndex(const int index) {
+	return FindSheetByIndex(Get(), index);
+}
+
+bool IsSheetPattern(const std::string &name) {
+	return name.find_first_of("*?") != std::string::npos;
+}
+
+// Matches a title against a pattern where * matches any run of characters and ? any single character
+static bool MatchSheetPattern(const std::string &title, const std::string &pattern) {
+	size_t t = 0;
+	size_t p = 0;
+	// Position after the last * seen and the title position it was tried at, for backtracking
+	size_t star = std::string::npos;
+	size_t star_t = 0;
+	while (t < title.size()) {
+		if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == title[t])) {
+			t++;
+			p++;
+		} else if (p < pattern.size() && pattern[p] == '*') {
+			star = ++p;
+			star_t = t;
+		} else if (star != std::string::npos) {
+			p = star;
+			t = ++star_t;
+		} else {
+			return false;
+		}
+	}
+	while (p < pattern.size() && pattern[p] == '*') {
+		p++;
+	}
+	return p == pattern.size();
+}
+
+std::vector<SheetMetadata> SpreadsheetResource::GetSheetsByPattern(const std::vector<std::string> &patterns) {
+	return FindSheetsByPattern(Get(), patterns);
+}
+
+std::vector<SheetMetadata> FindSheetsByPattern(const SpreadsheetMetadata &meta,
+                                               const std::vector<std::string> &patterns) {
+	std::vector<SheetMetadata> sheets;
+	std::vector<bool> matched(patterns.size(), false);
+	for (const auto &sheet : meta.sheets) {
+		bool match = false;
+		for (size_t i = 0; i < patterns.size(); i++) {
+			if (MatchSheetPattern(sheet.properties.title, patterns[i])) {
+				matched[i] = true;
+				match = true;
+			}
+		}
+		if (match) {
+			sheets.push_back(sheet);
+		}
+	}
+	for (size_t i = 0; i < patterns.size(); i++) {
+		if (!matched[i] && !IsSheetPattern(patterns[i])) {
+			throw SheetNotFoundException(patterns[i]);
+		}
+	}
+	return sheets;
+}
+
 SheetMetadata SpreadsheetResource::CreateSheet(const std::string &name) {
 	SpreadsheetUpdateRequest update;
 	update.addSheet.properties.title = name;
@@ -68,6 +144,21 @@ SheetMetadata SpreadsheetResource::CreateSheet(const std::string &name) {
 	return reply.addSheet;
 }
 
+std::vector<std::string> SpreadsheetResource::GetNumberFormatTypes(const A1Range &range) {
+	std::string path = "/spreadsheets/" + spreadsheetId + "?ranges=" + range.ToString() +
+	                   "&fields=sheets.data.rowData.values.effectiveFormat.numberFormat.type";
+	auto meta = ParseResponse<SpreadsheetMetadata>(DoGet(path));
+
+	std::vector<std::string> types;
+	if (meta.sheets.empty() || meta.sheets[0].data.empty() || meta.sheets[0].data[0].rowData.empty()) {
+		return types;
+	}
+	for (const auto &cell : meta.sheets[0].data[0].rowData[0].values) {
+		types.push_back(cell.effectiveFormat.numberFormat.type);
+	}
+	return types;
+}
+
 SpreadsheetBatchUpdateResponse SpreadsheetResource::BatchUpdate(const SpreadsheetBatchUpdateRequest &req) {
 	std::string path = "/spreadsheets/" + spreadsheetId + ":batchUpdate";
 	std::string body = json(req).dump();
@@ -2,6 +2,7 @@
 
 #include "sheets/types.hpp"
 #include "sheets/resources/values.hpp"
+#include "sheets/util/cell_decoder.hpp"
 #include "sheets/util/response.hpp"
 
 using json = nlohmann::json;
@@ -14,6 +15,86 @@ ValueRange ValuesResource::Get(const A1Range &range) {
 	return ParseResponse<ValueRange>(DoGet(path));
 }
 
+// Query parameters for the render option and major dimension, the API defaults are FORMATTED_VALUE and ROWS
+static std::string ReadParameters(ValueRenderOption render, MajorDimension major) {
+	std::string parameters;
+	if (render == UNFORMATTED_VALUE) {
+		parameters += "valueRenderOption=UNFORMATTED_VALUE&dateTimeRenderOption=SERIAL_NUMBER";
+	}
+	if (major == COLUMNS) {
+		parameters += std::string(parameters.empty() ? "" : "&") + "majorDimension=COLUMNS";
+	}
+	return parameters;
+}
+
+std::string ValuesResource::GetCellsPath(const A1Range &range, ValueRenderOption render, MajorDimension major) {
+	std::string path = "/spreadsheets/" + spreadsheetId + "/values/" + range.ToString();
+	auto parameters = ReadParameters(render, major);
+	if (!parameters.empty()) {
+		path += "?" + parameters;
+	}
+	return path;
+}
+
+std::string ValuesResource::BatchGetCellsPath(const std::vector<A1Range> &ranges, ValueRenderOption render,
+                                              MajorDimension major) {
+	std::string path = "/spreadsheets/" + spreadsheetId + "/values:batchGet";
+	for (size_t i = 0; i < ranges.size(); i++) {
+		path += (i == 0 ? "?ranges=" : "&ranges=") + ranges[i].ToString();
+	}
+	auto parameters = ReadParameters(render, major);
+	if (!parameters.empty()) {
+		path += (ranges.empty() ? "?" : "&") + parameters;
+	}
+	return path;
+}
+
+std::string ValuesResource::AppendPath(const A1Range &range) {
+	return "/spreadsheets/" + spreadsheetId + "/values/" + range.ToString() + ":append" +
+	       "?valueInputOption=USER_ENTERED";
+}
+
+static CellRange DecodeCellsResponse(const HttpResponse &response) {
+	CheckResponse(response);
+	return DecodeCellRange(response.body);
+}
+
+static BatchGetCellsResponse DecodeBatchGetCellsResponse(const HttpResponse &response) {
+	CheckResponse(response);
+	return DecodeBatchGetCells(response.body);
+}
+
+CellRange ValuesResource::GetCells(const A1Range &range, ValueRenderOption render, MajorDimension major) {
+	return DecodeCellsResponse(DoGet(GetCellsPath(range, render, major)));
+}
+
+BatchGetCellsResponse ValuesResource::BatchGetCells(const std::vector<A1Range> &ranges, ValueRenderOption render,
+                                                    MajorDimension major) {
+	return DecodeBatchGetCellsResponse(DoGet(BatchGetCellsPath(ranges, render, major)));
+}
+
+std::future<CellRange> ValuesResource::GetCellsAsync(const A1Range &range, ValueRenderOption render,
+                                                     MajorDimension major) {
+	return std::async(
+	    std::launch::deferred, [](std::future<HttpResponse> response) { return DecodeCellsResponse(response.get()); },
+	    DoGetAsync(GetCellsPath(range, render, major)));
+}
+
+std::future<BatchGetCellsResponse> ValuesResource::BatchGetCellsAsync(const std::vector<A1Range> &ranges,
+                                                                      ValueRenderOption render, MajorDimension major) {
+	return std::async(
+	    std::launch::deferred,
+	    [](std::future<HttpResponse> response) { return DecodeBatchGetCellsResponse(response.get()); },
+	    DoGetAsync(BatchGetCellsPath(ranges, render, major)));
+}
+
+std::future<AppendValuesResponse> ValuesResource::AppendAsync(const A1Range &range, const ValueRange &values) {
+	return std::async(
+	    std::launch::deferred,
+	    [](std::future<HttpResponse> response) { return ParseResponse<AppendValuesResponse>(response.get()); },
+	    DoPostAsync(AppendPath(range), json(values).dump()));
+}
+
 UpdateValuesResponse ValuesResource::Update(const A1Range &range, const ValueRange &values) {
 	std::string path =
 	    "/spreadsheets/" + spreadsheetId + "/values/" + range.ToString() + "?valueInputOption=USER_ENTERED";
@@ -22,10 +103,8 @@ UpdateValuesResponse ValuesResource::Update(const A1Range &range, const ValueRan
 }
 
 AppendValuesResponse ValuesResource::Append(const A1Range &range, const ValueRange &values) {
-	std::string path =
-	    "/spreadsheets/" + spreadsheetId + "/values/" + range.ToString() + ":append" + "?valueInputOption=USER_ENTERED";
 	std::string body = json(values).dump();
-	return ParseResponse<AppendValuesResponse>(DoPost(path, body));
+	return ParseResponse<AppendValuesResponse>(DoPost(AppendPath(range), body));
 }
 
 ClearValuesResponse ValuesResource::Clear(const A1Range &range) {
@@ -0,0 +1,204 @@
+#include "json.hpp"
+
+#include "sheets/transport/caching_http_client.hpp"
+
+using json = nlohmann::json;
+
+namespace duckdb {
+namespace sheets {
+
+std::string SpreadsheetIdFromUrl(const std::string &url) {
+	// Sheets API: .../v4/spreadsheets/{id}/values/..., Visualization API: .../spreadsheets/d/{id}/gviz/tq?...
+	static const std::string marker = "/spreadsheets/";
+	auto start = url.find(marker);
+	if (start == std::string::npos) {
+		return "";
+	}
+	start += marker.size();
+	if (url.compare(start, 2, "d/") == 0) {
+		start += 2;
+	}
+	auto end = url.find_first_of("/:?#", start);
+	return url.substr(start, end == std::string::npos ? std::string::npos : end - start);
+}
+
+bool IsCacheableRead(const HttpRequest &request) {
+	if (request.method != HttpMethod::GET) {
+		return false;
+	}
+	auto path_end = request.url.find('?');
+	auto path = request.url.substr(0, path_end);
+	return path.find("/values") != std::string::npos || path.find("/gviz/tq") != std::string::npos;
+}
+
+bool IsMetadataRead(const HttpRequest &request) {
+	if (request.method != HttpMethod::GET) {
+		return false;
+	}
+	auto path = request.url.substr(0, request.url.find('?'));
+	auto spreadsheet_id = SpreadsheetIdFromUrl(path);
+	return !spreadsheet_id.empty() && path.size() >= spreadsheet_id.size() &&
+	       path.compare(path.size() - spreadsheet_id.size(), spreadsheet_id.size(), spreadsheet_id) == 0 &&
+	       path.find("/gviz/") == std::string::npos;
+}
+
+std::string CachingHttpClient::GetVersion(const std::string &spreadsheetId, const HttpHeaders &headers) {
+	{
+		std::lock_guard<std::mutex> guard(metadata_lock);
+		auto known = versions.find(spreadsheetId);
+		if (known != versions.end()) {
+			return known->second;
+		}
+	}
+	// Threads reading the same spreadsheet at once may both fetch the version, the first one is kept
+	std::string version;
+	if (!cache->IsUnversioned(options.scope + "\n" + spreadsheetId)) {
+		version = FetchVersion(spreadsheetId, headers);
+	}
+	std::lock_guard<std::mutex> guard(metadata_lock);
+	return versions.emplace(spreadsheetId, version).first->second;
+}
+
+std::string CachingHttpClient::FetchVersion(const std::string &spreadsheetId, const HttpHeaders &headers) {
+	metrics->Increment(CACHE_VALIDATIONS_METRIC);
+	HttpRequest request;
+	request.method = HttpMethod::GET;
+	request.url = options.driveUrl + "/files/" + spreadsheetId + "?fields=version&supportsAllDrives=true";
+	request.headers = headers;
+	auto response = inner->Execute(request);
+	if (response.statusCode == 200) {
+		auto body = json::parse(response.body, nullptr, false);
+		if (body.is_object() && body.contains("version")) {
+			auto &version = body["version"];
+			// Drive returns the int64 version as a string
+			return version.is_string() ? version.get<std::string>() : version.dump();
+		}
+	}
+	metrics->Increment(CACHE_VALIDATION_ERRORS_METRIC);
+	// Missing scopes and files that aren't in Drive won't start working, other errors are retried next statement
+	if (response.statusCode == 401 || response.statusCode == 403 || response.statusCode == 404) {
+		cache->MarkUnversioned(options.scope + "\n" + spreadsheetId);
+	}
+	return "";
+}
+
+HttpResponse CachingHttpClient::Execute(const HttpRequest &request) {
+	auto spreadsheet_id = SpreadsheetIdFromUrl(request.url);
+	if (request.method != HttpMethod::GET) {
+		auto response = inner->Execute(request);
+		if (!spreadsheet_id.empty()) {
+			{
+				std::lock_guard<std::mutex> guard(metadata_lock);
+				metadata.clear();
+				versions.erase(spreadsheet_id);
+			}
+			cache->RemoveSpreadsheet(spreadsheet_id);
+			if (disk) {
+				disk->RemoveSpreadsheet(spreadsheet_id);
+			}
+		}
+		return response;
+	}
+	if (IsMetadataRead(request)) {
+		return ExecuteMetadataRead(request, spreadsheet_id);
+	}
+	bool use_memory = options.ttl.count() > 0;
+	if ((!use_memory && !disk) || spreadsheet_id.empty() || !IsCacheableRead(request)) {
+		return inner->Execute(request);
+	}
+
+	auto key = options.scope + "\n" + request.url;
+	ResponseCache::Entry entry;
+	if (use_memory && cache->Get(key, entry)) {
+		// Only a fresh response is validated, expired ones are refetched anyway
+		bool fresh = ResponseCache::Clock::now() - entry.storedAt < options.ttl;
+		bool current = !options.validate || (fresh && !entry.version.empty() &&
+		                                     entry.version == GetVersion(spreadsheet_id, request.headers));
+		if (fresh && current) {
+			metrics->Increment(CACHE_HITS_METRIC);
+			return entry.response;
+		}
+		cache->Remove(key);
+	}
+	if (disk && disk->Load(key, spreadsheet_id, entry) && !entry.version.empty() &&
+	    entry.version == GetVersion(spreadsheet_id, request.headers)) {
+		metrics->Increment(DISK_CACHE_HITS_METRIC);
+		if (use_memory) {
+			entry.storedAt = ResponseCache::Clock::now();
+			auto response = entry.response;
+			StoreInMemory(key, std::move(entry));
+			return response;
+		}
+		return entry.response;
+	}
+
+	metrics->Increment(CACHE_MISSES_METRIC);
+	// The version is read before the response, so an edit made in between makes the response look stale rather
+	// than current
+	std::string version;
+	if (options.validate || disk) {
+		version = GetVersion(spreadsheet_id, request.headers);
+	}
+	auto response = inner->Execute(request);
+	// Without a version a validated response couldn't be checked later
+	bool cacheable = response.statusCode == 200 && (!options.validate || !version.empty());
+	if (!cacheable) {
+		return response;
+	}
+	entry.response = response;
+	entry.spreadsheetId = spreadsheet_id;
+	entry.version = version;
+	entry.storedAt = ResponseCache::Clock::now();
+	if (disk && !version.empty()) {
+		auto evicted = disk->Store(key, entry);
+		if (evicted > 0) {
+			metrics->Increment(DISK_CACHE_EVICTIONS_METRIC, static_cast<int64_t>(evicted));
+		}
+	}
+	if (use_memory) {
+		StoreInMemory(key, std::move(entry));
+	}
+	return response;
+}
+
+HttpResponse CachingHttpClient::ExecuteMetadataRead(const HttpRequest &request, const std::string &spreadsheetId) {
+	{
+		std::lock_guard<std::mutex> guard(metadata_lock);
+		auto entry = metadata.find(request.url);
+		if (entry != metadata.end()) {
+			metrics->Increment(METADATA_CACHE_HITS_METRIC);
+			return entry->second;
+		}
+	}
+	auto key = options.scope + "\n" + request.url;
+	ResponseCache::Entry entry;
+	bool shared = options.metadataTtl.count() > 0;
+	if (shared && cache->Get(key, entry) && ResponseCache::Clock::now() - entry.storedAt < options.metadataTtl) {
+		metrics->Increment(METADATA_CACHE_HITS_METRIC);
+	} else {
+		metrics->Increment(METADATA_CACHE_MISSES_METRIC);
+		entry.response = inner->Execute(request);
+		if (entry.response.statusCode != 200) {
+			return entry.response;
+		}
+		if (shared) {
+			entry.spreadsheetId = spreadsheetId;
+			entry.version.clear();
+			entry.storedAt = ResponseCache::Clock::now();
+			StoreInMemory(key, entry);
+		}
+	}
+	std::lock_guard<std::mutex> guard(metadata_lock);
+	metadata[request.url] = entry.response;
+	return entry.response;
+}
+
+void CachingHttpClient::StoreInMemory(const std::string &key, ResponseCache::Entry entry) {
+	auto evicted = cache->Put(key, std::move(entry));
+	if (evicted > 0) {
+		metrics->Increment(CACHE_EVICTIONS_METRIC, static_cast<int64_t>(evicted));
+	}
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,16 +1,254 @@
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/main/secret/secret.hpp"
 
+#include "sheets/transport/caching_http_client.hpp"
+#include "sheets/transport/client_factory.hpp"
+#include "sheets/transport/compression_http_client.hpp"
+#include "sheets/transport/curl_http_client.hpp"
+#include "sheets/transport/duckdb_http_client.hpp"
 #include "sheets/transport/http_client.hpp"
 #include "sheets/transport/httplib_client.hpp"
+#include "sheets/transport/retry_http_client.hpp"
 #include "utils/proxy.hpp"
+#include "utils/secret.hpp"
+#include "utils/settings.hpp"
 
 namespace duckdb {
 namespace sheets {
 
-std::unique_ptr<IHttpClient> CreateHttpClient(ClientContext &ctx) {
+// Holds the response cache in the database's object cache
+class ResponseCacheEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "gsheets_response_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	ResponseCache cache;
+};
+
+// Holds the metrics in the database's object cache
+class MetricsEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "gsheets_metrics";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	Metrics metrics;
+};
+
+std::shared_ptr<ResponseCache> GetResponseCache(ClientContext &ctx) {
+	auto &object_cache = ObjectCache::GetObjectCache(ctx);
+	auto entry = object_cache.GetOrCreate<ResponseCacheEntry>(ResponseCacheEntry::ObjectType());
+	return std::shared_ptr<ResponseCache>(entry, &entry->cache);
+}
+
+std::shared_ptr<Metrics> GetMetrics(ClientContext &ctx) {
+	auto &object_cache = ObjectCache::GetObjectCache(ctx);
+	auto entry = object_cache.GetOrCreate<MetricsEntry>(MetricsEntry::ObjectType());
+	return std::shared_ptr<Metrics>(entry, &entry->metrics);
+}
+
+// Holds the latencies of recent GETs in the database's object cache
+class LatencyTrackerEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "gsheets_latency_tracker";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	LatencyTracker latencies;
+};
+
+std::shared_ptr<LatencyTracker> GetLatencyTracker(ClientContext &ctx) {
+	auto &object_cache = ObjectCache::GetObjectCache(ctx);
+	auto entry = object_cache.GetOrCreate<LatencyTrackerEntry>(LatencyTrackerEntry::ObjectType());
+	return std::shared_ptr<LatencyTracker>(entry, &entry->latencies);
+}
+
+// Holds the stores of the cache directories used by the database in its object cache
+class DiskResponseStoreEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "gsheets_disk_response_stores";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	std::mutex lock;
+	std::map<std::string, std::unique_ptr<DiskResponseStore>> stores;
+};
+
+std::shared_ptr<DiskResponseStore> GetDiskResponseStore(ClientContext &ctx) {
+	auto directory = GetStringSetting(ctx, CACHE_DIRECTORY_SETTING, "");
+	if (directory.empty()) {
+		return nullptr;
+	}
+	// One store per directory, each keeps the index of its directory in memory
+	auto &object_cache = ObjectCache::GetObjectCache(ctx);
+	auto entry = object_cache.GetOrCreate<DiskResponseStoreEntry>(DiskResponseStoreEntry::ObjectType());
+	std::lock_guard<std::mutex> guard(entry->lock);
+	auto &store = entry->stores[directory];
+	if (!store) {
+		auto &fs = FileSystem::GetFileSystem(ctx);
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		store = make_uniq<DiskResponseStore>(directory);
+	}
+	auto max_bytes = GetBigintSetting(ctx, CACHE_DIRECTORY_MAX_BYTES_SETTING, DEFAULT_DISK_CACHE_MAX_BYTES);
+	auto evicted = store->SetMaxBytes(static_cast<size_t>(MaxValue<int64_t>(max_bytes, 0)));
+	if (evicted > 0) {
+		GetMetrics(ctx)->Increment(DISK_CACHE_EVICTIONS_METRIC, static_cast<int64_t>(evicted));
+	}
+	// Stores are never removed from the entry, which is kept alive for as long as the store is used
+	return std::shared_ptr<DiskResponseStore>(entry, store.get());
+}
+
+// Holds the scheduler in the database's object cache
+class RequestSchedulerEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "gsheets_request_scheduler";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	RequestScheduler scheduler;
+};
+
+std::shared_ptr<RequestScheduler> GetRequestScheduler(ClientContext &ctx) {
+	auto &object_cache = ObjectCache::GetObjectCache(ctx);
+	auto entry = object_cache.GetOrCreate<RequestSchedulerEntry>(RequestSchedulerEntry::ObjectType());
+	SchedulerOptions options;
+	options.readsPerMinute =
+	    GetBigintSetting(ctx, READ_REQUESTS_PER_MINUTE_SETTING, DEFAULT_READ_REQUESTS_PER_MINUTE);
+	options.writesPerMinute =
+	    GetBigintSetting(ctx, WRITE_REQUESTS_PER_MINUTE_SETTING, DEFAULT_WRITE_REQUESTS_PER_MINUTE);
+	auto max_in_flight = GetBigintSetting(ctx, MAX_REQUESTS_IN_FLIGHT_SETTING, DEFAULT_MAX_REQUESTS_IN_FLIGHT);
+	options.maxInFlight = static_cast<size_t>(MaxValue<int64_t>(max_in_flight, 0));
+	entry->scheduler.Configure(options);
+	// Shares ownership of the entry, which outlives its removal from the cache
+	return std::shared_ptr<RequestScheduler>(entry, &entry->scheduler);
+}
+
+// Identifies the credentials of the gsheet secret, so that cached responses are only served to the same account.
+// Tokens are hashed rather than kept in the cache keys.
+static std::string CacheScope(ClientContext &ctx) {
+	auto match = GetSecretMatch(ctx, "gsheet", "gsheet");
+	if (!match.HasMatch()) {
+		return "";
+	}
+	auto secret = dynamic_cast<const KeyValueSecret *>(&match.GetSecret());
+	if (!secret) {
+		return "";
+	}
+	Value value;
+	if (secret->GetProvider() == "key_file" && secret->TryGetValue("email", value)) {
+		return "key_file:" + value.ToString();
+	}
+	if (secret->TryGetValue("token", value)) {
+		return "token:" + std::to_string(std::hash<std::string> {}(value.ToString()));
+	}
+	return "";
+}
+
+// The client sending requests over the network, chosen by the gsheets_http_client setting
+static std::unique_ptr<IHttpClient> CreateTransport(ClientContext &ctx, const std::shared_ptr<Metrics> &metrics) {
+	auto name = StringUtil::Lower(GetStringSetting(ctx, HTTP_CLIENT_SETTING, DEFAULT_HTTP_CLIENT));
+	if (name == "duckdb") {
+		return make_uniq<DuckDBHttpClient>(ctx, metrics);
+	}
+	HttpTimeouts timeouts;
+	auto connect_timeout = GetBigintSetting(ctx, HTTP_CONNECT_TIMEOUT_SETTING, DEFAULT_HTTP_CONNECT_TIMEOUT);
+	timeouts.connect = std::chrono::seconds(MaxValue<int64_t>(connect_timeout, 0));
+	auto read_timeout = GetBigintSetting(ctx, HTTP_READ_TIMEOUT_SETTING, DEFAULT_HTTP_READ_TIMEOUT);
+	timeouts.read = std::chrono::seconds(MaxValue<int64_t>(read_timeout, 0));
+	auto total_timeout = GetBigintSetting(ctx, HTTP_TIMEOUT_SETTING, DEFAULT_HTTP_TIMEOUT);
+	timeouts.total = std::chrono::seconds(MaxValue<int64_t>(total_timeout, 0));
 	auto proxy_config = GetHttpProxyConfig(ctx);
-	return make_uniq<HttpLibClient>(proxy_config);
+	if (name == "curl") {
+#ifdef GSHEETS_HAS_CURL
+		return make_uniq<CurlHttpClient>(proxy_config, CurlOptions(), metrics, timeouts);
+#else
+		throw InvalidInputException("%s 'curl' is not available, this build of the gsheets extension doesn't include "
+		                            "libcurl",
+		                            HTTP_CLIENT_SETTING);
+#endif
+	}
+	if (name != "httplib") {
+		throw InvalidInputException("Unknown %s '%s', expected 'httplib', 'duckdb' or 'curl'", HTTP_CLIENT_SETTING,
+		                            name);
+	}
+	ConnectionPoolOptions pool_options;
+	pool_options.keepAlive = GetBooleanSetting(ctx, HTTP_KEEP_ALIVE_SETTING, true);
+	auto idle_timeout = GetBigintSetting(ctx, HTTP_IDLE_TIMEOUT_SETTING, DEFAULT_HTTP_IDLE_TIMEOUT);
+	pool_options.idleTimeout = std::chrono::seconds(MaxValue<int64_t>(idle_timeout, 0));
+	return make_uniq<HttpLibClient>(proxy_config, pool_options, metrics, timeouts);
+}
+
+std::unique_ptr<IHttpClient> CreateHttpClient(ClientContext &ctx) {
+	auto metrics = GetMetrics(ctx);
+	auto client = CreateTransport(ctx, metrics);
+	auto scheduler = GetRequestScheduler(ctx);
+	if (GetBooleanSetting(ctx, HTTP_HEDGING_SETTING, false)) {
+		// Below the scheduler so that latencies don't include the wait for a turn. Hedges are admitted by the
+		// scheduler too and count against the read quota, and a hedged GET is retried as one request.
+		client = make_uniq<HedgingHttpClient>(std::move(client), GetLatencyTracker(ctx), *metrics, HedgingOptions(),
+		                                      scheduler);
+	}
+	// Below the retries, so that every attempt waits for its turn and retries don't hold a slot while backing off
+	client = make_uniq<SchedulingHttpClient>(std::move(client), std::move(scheduler), *metrics);
+
+	RetryOptions retry;
+	auto retries = GetBigintSetting(ctx, HTTP_RETRIES_SETTING, DEFAULT_HTTP_RETRIES);
+	retry.maxRetries = static_cast<int>(MaxValue<int64_t>(retries, 0));
+	auto max_wait = GetBigintSetting(ctx, HTTP_RETRY_MAX_WAIT_SETTING, DEFAULT_HTTP_RETRY_MAX_WAIT);
+	retry.maxBackoff = std::chrono::seconds(MaxValue<int64_t>(max_wait, 0));
+	client = make_uniq<RetryHttpClient>(std::move(client), *metrics, std::move(retry));
+
+	CompressionOptions compression;
+	compression.acceptGzip = GetBooleanSetting(ctx, HTTP_COMPRESSION_SETTING, true);
+	compression.compressRequests = GetBooleanSetting(ctx, COMPRESS_REQUESTS_SETTING, false);
+	client = make_uniq<CompressionHttpClient>(std::move(client), *metrics, compression);
+
+	// The cache wraps every client, even with the cache disabled, so that writes invalidate cached responses
+	auto cache = GetResponseCache(ctx);
+	auto max_bytes = GetBigintSetting(ctx, CACHE_MAX_BYTES_SETTING, DEFAULT_CACHE_MAX_BYTES);
+	auto evicted = cache->SetMaxBytes(static_cast<size_t>(MaxValue<int64_t>(max_bytes, 0)));
+	if (evicted > 0) {
+		metrics->Increment(CACHE_EVICTIONS_METRIC, static_cast<int64_t>(evicted));
+	}
+	CacheOptions options;
+	auto ttl = GetBigintSetting(ctx, CACHE_TTL_SETTING, DEFAULT_CACHE_TTL);
+	options.ttl = std::chrono::seconds(MaxValue<int64_t>(ttl, 0));
+	auto metadata_ttl = GetBigintSetting(ctx, METADATA_CACHE_TTL_SETTING, DEFAULT_METADATA_CACHE_TTL);
+	options.metadataTtl = std::chrono::seconds(MaxValue<int64_t>(metadata_ttl, 0));
+	options.validate = GetBooleanSetting(ctx, CACHE_VALIDATE_SETTING, false);
+	auto disk = GetDiskResponseStore(ctx);
+	if (options.ttl.count() > 0 || options.metadataTtl.count() > 0 || disk) {
+		options.scope = CacheScope(ctx);
+	}
+	return make_uniq<CachingHttpClient>(std::move(client), std::move(cache), std::move(metrics), std::move(options),
+	                                    std::move(disk));
 }
 
 } // namespace sheets
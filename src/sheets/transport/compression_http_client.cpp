@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cctype>
+
+#include "sheets/transport/compression_http_client.hpp"
+#include "sheets/util/gzip.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+static bool EqualsIgnoreCase(const std::string &a, const std::string &b) {
+	return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+		       return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+	       });
+}
+
+// Header names are case-insensitive and HTTP/2 responses use lowercase ones
+static HttpHeaders::iterator FindHeader(HttpHeaders &headers, const std::string &name) {
+	for (auto header = headers.begin(); header != headers.end(); ++header) {
+		if (EqualsIgnoreCase(header->first, name)) {
+			return header;
+		}
+	}
+	return headers.end();
+}
+
+// Whether a body starts like gzip or zlib data. Transports that decode bodies themselves (e.g. DuckDB's HTTPUtil)
+// may keep the Content-Encoding header.
+static bool IsEncoded(const std::string &body) {
+	if (body.size() < 2) {
+		return false;
+	}
+	auto first = static_cast<unsigned char>(body[0]);
+	auto second = static_cast<unsigned char>(body[1]);
+	bool gzip = first == 0x1f && second == 0x8b;
+	bool zlib = (first & 0x0f) == 8 && ((first << 8) | second) % 31 == 0;
+	return gzip || zlib;
+}
+
+HttpResponse CompressionHttpClient::Execute(const HttpRequest &request) {
+	HttpRequest encoded = request;
+	if (options.acceptGzip) {
+		encoded.headers["Accept-Encoding"] = "gzip";
+		// Google APIs only send gzip to user agents that mention it
+		auto user_agent = FindHeader(encoded.headers, "User-Agent");
+		if (user_agent == encoded.headers.end()) {
+			encoded.headers["User-Agent"] = "gzip";
+		} else if (user_agent->second.find("gzip") == std::string::npos) {
+			user_agent->second += " (gzip)";
+		}
+	}
+	bool has_body = request.method == HttpMethod::POST || request.method == HttpMethod::PUT;
+	if (options.compressRequests && has_body && request.body.size() >= options.minRequestBytes) {
+		encoded.body = GzipCompress(request.body);
+		encoded.headers["Content-Encoding"] = "gzip";
+	}
+	metrics.Increment(REQUEST_BYTES_METRIC, static_cast<int64_t>(encoded.body.size()));
+	metrics.Increment(REQUEST_BYTES_UNCOMPRESSED_METRIC, static_cast<int64_t>(request.body.size()));
+
+	auto response = inner->Execute(encoded);
+	metrics.Increment(RESPONSE_BYTES_METRIC, static_cast<int64_t>(response.body.size()));
+	auto encoding = FindHeader(response.headers, "Content-Encoding");
+	if (encoding != response.headers.end() &&
+	    (EqualsIgnoreCase(encoding->second, "gzip") || EqualsIgnoreCase(encoding->second, "deflate")) &&
+	    IsEncoded(response.body)) {
+		response.body = GzipDecompress(response.body);
+		response.headers.erase(encoding);
+	}
+	metrics.Increment(RESPONSE_BYTES_DECOMPRESSED_METRIC, static_cast<int64_t>(response.body.size()));
+	return response;
+}
+
+} // namespace sheets
+} // namespace duckdb
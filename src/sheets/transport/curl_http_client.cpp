@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+#include <curl/curl.h>
+
+#include "duckdb/common/exception.hpp"
+
+#include "sheets/transport/curl_http_client.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// One request handed to the loop, owned by the loop until it completes
+struct CurlTransfer {
+	CURL *easy = nullptr;
+	curl_slist *headers = nullptr;
+	// Kept alive for the transfer, curl doesn't copy POSTFIELDS
+	std::string body;
+	HttpResponse response;
+	std::promise<HttpResponse> promise;
+	std::shared_ptr<Metrics> metrics;
+	std::shared_ptr<std::atomic<bool>> cancelled;
+	char error[CURL_ERROR_SIZE] = {0};
+
+	~CurlTransfer() {
+		if (easy) {
+			curl_easy_cleanup(easy);
+		}
+		curl_slist_free_all(headers);
+	}
+};
+
+static bool IsContentType(const std::string &name) {
+	static const std::string content_type = "content-type";
+	return name.size() == content_type.size() &&
+	       std::equal(name.begin(), name.end(), content_type.begin(),
+	                  [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+}
+
+static size_t WriteBody(char *data, size_t size, size_t count, void *user_data) {
+	auto transfer = static_cast<CurlTransfer *>(user_data);
+	transfer->response.body.append(data, size * count);
+	return size * count;
+}
+
+static size_t WriteHeader(char *data, size_t size, size_t count, void *user_data) {
+	auto transfer = static_cast<CurlTransfer *>(user_data);
+	std::string line(data, size * count);
+	if (line.compare(0, 5, "HTTP/") == 0) {
+		// Status line of a new response, e.g. after 100 Continue
+		transfer->response.headers.clear();
+		return size * count;
+	}
+	auto colon = line.find(':');
+	if (colon != std::string::npos) {
+		auto value_start = line.find_first_not_of(" \t", colon + 1);
+		auto value_end = line.find_last_not_of(" \t\r\n");
+		auto value = value_start == std::string::npos || value_end < value_start
+		                 ? std::string()
+		                 : line.substr(value_start, value_end - value_start + 1);
+		transfer->response.headers[line.substr(0, colon)] = value;
+	}
+	return size * count;
+}
+
+// Aborts the transfer once the request is cancelled
+static int CheckCancelled(void *user_data, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+	auto transfer = static_cast<CurlTransfer *>(user_data);
+	return transfer->cancelled && *transfer->cancelled ? 1 : 0;
+}
+
+// Serializes access to the data the share holds, one lock per kind of data
+static void LockShare(CURL *, curl_lock_data data, curl_lock_access, void *user_data) {
+	static_cast<std::mutex *>(user_data)[data].lock();
+}
+
+static void UnlockShare(CURL *, curl_lock_data data, void *user_data) {
+	static_cast<std::mutex *>(user_data)[data].unlock();
+}
+
+// Runs every transfer of the process on one thread with curl_multi_poll, waking up when transfers are queued
+class CurlMultiLoop {
+public:
+	CurlMultiLoop() {
+		curl_global_init(CURL_GLOBAL_DEFAULT);
+		multi = curl_multi_init();
+		curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+		// DNS results and TLS sessions are reused by later connections. Easy handles are attached to the share on
+		// the threads sending requests while the loop thread uses it, so it needs locks.
+		share = curl_share_init();
+		curl_share_setopt(share, CURLSHOPT_LOCKFUNC, LockShare);
+		curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+		curl_share_setopt(share, CURLSHOPT_USERDATA, share_locks);
+		curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		thread = std::thread(&CurlMultiLoop::Run, this);
+	}
+
+	// Stops the loop before the handles it uses are cleaned up, and those before curl itself
+	~CurlMultiLoop() {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		curl_multi_wakeup(multi);
+		thread.join();
+		curl_multi_cleanup(multi);
+		curl_share_cleanup(share);
+		curl_global_cleanup();
+	}
+
+	CURLSH *Share() {
+		return share;
+	}
+
+	void Add(std::unique_ptr<CurlTransfer> transfer) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (stopping) {
+				Fail(std::move(transfer), "the HTTP client is shutting down");
+				return;
+			}
+			queued.push_back(std::move(transfer));
+		}
+		curl_multi_wakeup(multi);
+	}
+
+private:
+	void Run() {
+		int running = 0;
+		while (true) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				for (auto &transfer : queued) {
+					curl_multi_add_handle(multi, transfer->easy);
+					// Owned through CURLOPT_PRIVATE until it completes
+					active.insert(transfer->easy);
+					transfer.release();
+				}
+				queued.clear();
+				if (stopping) {
+					break;
+				}
+			}
+			curl_multi_perform(multi, &running);
+			CURLMsg *message;
+			int left;
+			while ((message = curl_multi_info_read(multi, &left))) {
+				if (message->msg == CURLMSG_DONE) {
+					Complete(message->easy_handle, message->data.result);
+				}
+			}
+			// Cancelled requests are only noticed while curl runs, so it runs at least every 100ms
+			curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+		}
+		// Transfers still in flight when the process exits are failed rather than waited for
+		while (!active.empty()) {
+			auto easy = *active.begin();
+			Fail(Remove(easy), "the HTTP client is shutting down");
+		}
+	}
+
+	std::unique_ptr<CurlTransfer> Remove(CURL *easy) {
+		CurlTransfer *pointer = nullptr;
+		curl_easy_getinfo(easy, CURLINFO_PRIVATE, &pointer);
+		curl_multi_remove_handle(multi, easy);
+		active.erase(easy);
+		return std::unique_ptr<CurlTransfer>(pointer);
+	}
+
+	static void Fail(std::unique_ptr<CurlTransfer> transfer, const std::string &reason) {
+		transfer->promise.set_exception(std::make_exception_ptr(IOException("HTTP request failed: " + reason)));
+	}
+
+	void Complete(CURL *easy, CURLcode result) {
+		auto transfer = Remove(easy);
+		if (result != CURLE_OK) {
+			std::string reason = transfer->error[0] ? transfer->error : curl_easy_strerror(result);
+			Fail(std::move(transfer), reason);
+			return;
+		}
+		long status = 0;
+		curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
+		transfer->response.statusCode = static_cast<int>(status);
+		if (transfer->metrics) {
+			long connects = 0;
+			curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects);
+			transfer->metrics->Increment(connects > 0 ? CONNECTIONS_OPENED_METRIC : CONNECTIONS_REUSED_METRIC);
+		}
+		transfer->promise.set_value(std::move(transfer->response));
+	}
+
+	CURLM *multi;
+	CURLSH *share;
+	std::mutex share_locks[CURL_LOCK_DATA_LAST];
+	std::thread thread;
+	std::mutex lock;
+	std::deque<std::unique_ptr<CurlTransfer>> queued;
+	// Transfers added to the multi handle, only used by the loop thread
+	std::unordered_set<CURL *> active;
+	bool stopping = false;
+};
+
+// Created on first use and shared by the clients. The loop initializes curl, so it is torn down before curl's own
+// cleanup at exit, and clients still alive at that point keep it running until they are destroyed.
+static std::shared_ptr<CurlMultiLoop> DefaultCurlLoop() {
+	static std::shared_ptr<CurlMultiLoop> loop = std::make_shared<CurlMultiLoop>();
+	return loop;
+}
+
+CurlHttpClient::CurlHttpClient(HttpProxyConfig proxy_config, CurlOptions options, std::shared_ptr<Metrics> metrics,
+                               HttpTimeouts timeouts)
+    : proxy_config(std::move(proxy_config)), options(options), metrics(std::move(metrics)), timeouts(timeouts),
+      loop(DefaultCurlLoop()) {
+}
+
+HttpResponse CurlHttpClient::Execute(const HttpRequest &request) {
+	return ExecuteAsync(request).get();
+}
+
+std::future<HttpResponse> CurlHttpClient::ExecuteAsync(const HttpRequest &request) {
+	std::unique_ptr<CurlTransfer> transfer(new CurlTransfer());
+	transfer->metrics = metrics;
+	transfer->easy = curl_easy_init();
+	if (!transfer->easy) {
+		throw IOException("HTTP request failed: could not create a curl handle");
+	}
+	auto easy = transfer->easy;
+	curl_easy_setopt(easy, CURLOPT_URL, request.url.c_str());
+	curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+	curl_easy_setopt(easy, CURLOPT_SHARE, loop->Share());
+	curl_easy_setopt(easy, CURLOPT_PRIVATE, transfer.get());
+	curl_easy_setopt(easy, CURLOPT_ERRORBUFFER, transfer->error);
+	curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, WriteBody);
+	curl_easy_setopt(easy, CURLOPT_WRITEDATA, transfer.get());
+	curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, WriteHeader);
+	curl_easy_setopt(easy, CURLOPT_HEADERDATA, transfer.get());
+	curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+	curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(timeouts.connect.count()));
+	curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, static_cast<long>(timeouts.total.count()));
+	// curl has no read timeout, a transfer below 1 byte per second for that long (in whole seconds) is aborted
+	auto read_seconds =
+	    std::chrono::duration_cast<std::chrono::seconds>(timeouts.read + std::chrono::milliseconds(999));
+	if (read_seconds.count() > 0) {
+		curl_easy_setopt(easy, CURLOPT_LOW_SPEED_LIMIT, 1L);
+		curl_easy_setopt(easy, CURLOPT_LOW_SPEED_TIME, static_cast<long>(read_seconds.count()));
+	}
+	if (request.cancelled) {
+		transfer->cancelled = request.cancelled;
+		curl_easy_setopt(easy, CURLOPT_XFERINFOFUNCTION, CheckCancelled);
+		curl_easy_setopt(easy, CURLOPT_XFERINFODATA, transfer.get());
+		curl_easy_setopt(easy, CURLOPT_NOPROGRESS, 0L);
+	}
+	if (options.http2) {
+		curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		// Wait for a connection that is being opened to the host rather than opening another one
+		curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+	} else {
+		curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+	}
+	if (!proxy_config.host.empty()) {
+		curl_easy_setopt(easy, CURLOPT_PROXY, proxy_config.host.c_str());
+		curl_easy_setopt(easy, CURLOPT_PROXYPORT, static_cast<long>(proxy_config.port));
+		if (!proxy_config.username.empty()) {
+			curl_easy_setopt(easy, CURLOPT_PROXYUSERNAME, proxy_config.username.c_str());
+			curl_easy_setopt(easy, CURLOPT_PROXYPASSWORD, proxy_config.password.c_str());
+		}
+	}
+
+	bool has_body = request.method == HttpMethod::POST || request.method == HttpMethod::PUT;
+	bool has_content_type = false;
+	for (const auto &h : request.headers) {
+		has_content_type = has_content_type || IsContentType(h.first);
+		transfer->headers = curl_slist_append(transfer->headers, (h.first + ": " + h.second).c_str());
+	}
+	if (has_body && !has_content_type) {
+		transfer->headers = curl_slist_append(transfer->headers, "Content-Type: application/json");
+	}
+	// No "Expect: 100-continue" round trip before sending a body
+	transfer->headers = curl_slist_append(transfer->headers, "Expect:");
+	curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer->headers);
+
+	switch (request.method) {
+	case HttpMethod::GET:
+		curl_easy_setopt(easy, CURLOPT_HTTPGET, 1L);
+		break;
+	case HttpMethod::POST:
+	case HttpMethod::PUT:
+		transfer->body = request.body;
+		curl_easy_setopt(easy, CURLOPT_POST, 1L);
+		curl_easy_setopt(easy, CURLOPT_POSTFIELDS, transfer->body.data());
+		curl_easy_setopt(easy, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(transfer->body.size()));
+		if (request.method == HttpMethod::PUT) {
+			curl_easy_setopt(easy, CURLOPT_CUSTOMREQUEST, "PUT");
+		}
+		break;
+	case HttpMethod::DEL:
+		curl_easy_setopt(easy, CURLOPT_CUSTOMREQUEST, "DELETE");
+		break;
+	}
+
+	auto result = transfer->promise.get_future();
+	loop->Add(std::move(transfer));
+	return result;
+}
+
+} // namespace sheets
+} // namespace duckdb
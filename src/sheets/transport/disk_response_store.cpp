@@ -0,0 +1,249 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "sheets/transport/disk_response_store.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+static const char *FILE_MAGIC = "GSHEETS_RESPONSE 1";
+static const char *INDEX_MAGIC = "GSHEETS_INDEX 1";
+static const char *INDEX_NAME = "index";
+
+// FNV-1a, stable across platforms and runs unlike std::hash
+static uint64_t HashKey(const std::string &key) {
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : key) {
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static std::string FileName(const std::string &key, const std::string &spreadsheetId) {
+	std::string name;
+	for (char c : spreadsheetId) {
+		bool safe = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+		name += safe ? c : '_';
+	}
+	char hash[17];
+	snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(HashKey(key)));
+	return name + "-" + hash + ".response";
+}
+
+static bool ReadString(std::istream &in, size_t size, std::string &out) {
+	out.assign(size, '\0');
+	if (size > 0) {
+		in.read(&out[0], static_cast<std::streamsize>(size));
+	}
+	return static_cast<size_t>(in.gcount()) == size || size == 0;
+}
+
+std::string DiskResponseStore::Path(const std::string &name) const {
+	if (!directory.empty() && (directory.back() == '/' || directory.back() == '\\')) {
+		return directory + name;
+	}
+	return directory + "/" + name;
+}
+
+DiskResponseStore::~DiskResponseStore() {
+	std::lock_guard<std::mutex> guard(lock);
+	if (indexDirty) {
+		SaveIndex();
+	}
+}
+
+void DiskResponseStore::LoadIndex() {
+	if (indexLoaded) {
+		return;
+	}
+	indexLoaded = true;
+	std::ifstream in(Path(INDEX_NAME), std::ios::binary);
+	std::string line;
+	if (!std::getline(in, line) || line.compare(0, std::string(INDEX_MAGIC).size(), INDEX_MAGIC) != 0) {
+		return;
+	}
+	std::istringstream(line.substr(std::string(INDEX_MAGIC).size())) >> useCounter;
+	while (std::getline(in, line)) {
+		std::istringstream fields(line);
+		std::string name;
+		File file;
+		if (fields >> name >> file.size >> file.lastUse >> file.spreadsheetId) {
+			bytes += file.size;
+			files[name] = file;
+		}
+	}
+}
+
+void DiskResponseStore::SaveIndex() {
+	indexDirty = false;
+	auto path = Path(INDEX_NAME);
+	auto temp_path = path + ".tmp";
+	{
+		std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			return;
+		}
+		out << INDEX_MAGIC << " " << useCounter << "\n";
+		for (auto &file : files) {
+			out << file.first << " " << file.second.size << " " << file.second.lastUse << " "
+			    << file.second.spreadsheetId << "\n";
+		}
+	}
+	// rename doesn't replace an existing file on every platform
+	std::remove(path.c_str());
+	std::rename(temp_path.c_str(), path.c_str());
+}
+
+bool DiskResponseStore::Load(const std::string &key, const std::string &spreadsheetId, ResponseCache::Entry &entry) {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	auto file = files.find(FileName(key, spreadsheetId));
+	if (file == files.end()) {
+		return false;
+	}
+
+	std::ifstream in(Path(file->first), std::ios::binary);
+	std::string magic;
+	int status_code = 0;
+	size_t version_size = 0, id_size = 0, key_size = 0, body_size = 0;
+	std::string stored_key;
+	bool valid = std::getline(in, magic) && magic == FILE_MAGIC &&
+	             (in >> status_code >> version_size >> id_size >> key_size >> body_size) && in.get() == '\n' &&
+	             ReadString(in, version_size, entry.version) && ReadString(in, id_size, entry.spreadsheetId) &&
+	             ReadString(in, key_size, stored_key) && stored_key == key &&
+	             ReadString(in, body_size, entry.response.body);
+	if (!valid) {
+		// Missing, truncated or a hash collision
+		RemoveFile(file);
+		SaveIndex();
+		return false;
+	}
+	entry.response.statusCode = status_code;
+	entry.response.headers.clear();
+	// Saving the index on every hit would rewrite it under the lock for each read
+	file->second.lastUse = ++useCounter;
+	indexDirty = true;
+	return true;
+}
+
+size_t DiskResponseStore::Store(const std::string &key, const ResponseCache::Entry &entry) {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	auto name = FileName(key, entry.spreadsheetId);
+	auto existing = files.find(name);
+	if (existing != files.end()) {
+		RemoveFile(existing);
+	}
+
+	auto path = Path(name);
+	auto temp_path = path + ".tmp";
+	size_t size;
+	{
+		std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			return 0;
+		}
+		out << FILE_MAGIC << "\n"
+		    << entry.response.statusCode << " " << entry.version.size() << " " << entry.spreadsheetId.size() << " "
+		    << key.size() << " " << entry.response.body.size() << "\n";
+		out << entry.version << entry.spreadsheetId << key << entry.response.body;
+		size = static_cast<size_t>(out.tellp());
+		if (!out) {
+			out.close();
+			std::remove(temp_path.c_str());
+			return 0;
+		}
+	}
+	if (size > maxBytes) {
+		std::remove(temp_path.c_str());
+		return 0;
+	}
+	std::remove(path.c_str());
+	if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+		std::remove(temp_path.c_str());
+		return 0;
+	}
+	files[name] = File {entry.spreadsheetId, size, ++useCounter};
+	bytes += size;
+	auto evicted = EvictToBudget();
+	SaveIndex();
+	return evicted;
+}
+
+void DiskResponseStore::RemoveSpreadsheet(const std::string &spreadsheetId) {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	bool removed = false;
+	for (auto file = files.begin(); file != files.end();) {
+		auto next = std::next(file);
+		if (file->second.spreadsheetId == spreadsheetId) {
+			RemoveFile(file);
+			removed = true;
+		}
+		file = next;
+	}
+	if (removed) {
+		SaveIndex();
+	}
+}
+
+size_t DiskResponseStore::Clear() {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	size_t count = files.size();
+	while (!files.empty()) {
+		RemoveFile(files.begin());
+	}
+	SaveIndex();
+	return count;
+}
+
+size_t DiskResponseStore::SetMaxBytes(size_t maxBytes_p) {
+	std::lock_guard<std::mutex> guard(lock);
+	maxBytes = maxBytes_p;
+	LoadIndex();
+	auto evicted = EvictToBudget();
+	if (evicted > 0) {
+		SaveIndex();
+	}
+	return evicted;
+}
+
+size_t DiskResponseStore::FileCount() {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	return files.size();
+}
+
+size_t DiskResponseStore::ByteCount() {
+	std::lock_guard<std::mutex> guard(lock);
+	LoadIndex();
+	return bytes;
+}
+
+void DiskResponseStore::RemoveFile(std::map<std::string, File>::iterator file) {
+	std::remove(Path(file->first).c_str());
+	bytes -= file->second.size;
+	files.erase(file);
+}
+
+size_t DiskResponseStore::EvictToBudget() {
+	size_t evicted = 0;
+	while (bytes > maxBytes && !files.empty()) {
+		auto oldest = files.begin();
+		for (auto file = files.begin(); file != files.end(); ++file) {
+			if (file->second.lastUse < oldest->second.lastUse) {
+				oldest = file;
+			}
+		}
+		RemoveFile(oldest);
+		evicted++;
+	}
+	return evicted;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,19 +1,123 @@
 #include "sheets/transport/duckdb_http_client.hpp"
+
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/http_util.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
 
 namespace duckdb {
 namespace sheets {
 
-DuckDBHttpClient::DuckDBHttpClient(DatabaseInstance &db) {
-	throw NotImplementedException("DuckDBHttpClient: Waiting for HTTPUtil POST support");
+// Host of the parameters, HTTPUtil only looks at it to pick the http secret
+constexpr const char *PARAMETERS_URL = "https://sheets.googleapis.com";
+
+// RetryHttpClient retries with backoff and knows which requests can be sent twice, HTTPUtil's own retries would
+// resend appends
+static void DisableRetries(HTTPParams &params) {
+	params.retries = 0;
+}
+
+DuckDBHttpClient::DuckDBHttpClient(DatabaseInstance &db, std::shared_ptr<Metrics> metrics)
+    : http_util(HTTPUtil::Get(db)), params(http_util.InitializeParameters(db, PARAMETERS_URL)),
+      metrics(std::move(metrics)) {
+	DisableRetries(*params);
+}
+
+DuckDBHttpClient::DuckDBHttpClient(ClientContext &context, std::shared_ptr<Metrics> metrics)
+    : http_util(HTTPUtil::Get(*context.db)), params(http_util.InitializeParameters(context, PARAMETERS_URL)),
+      metrics(std::move(metrics)) {
+	DisableRetries(*params);
+}
+
+DuckDBHttpClient::~DuckDBHttpClient() = default;
+
+void DuckDBHttpClient::Count(const char *metric) {
+	if (metrics) {
+		metrics->Increment(metric);
+	}
+}
+
+std::unique_ptr<HTTPClient> DuckDBHttpClient::Acquire(const std::string &protoHostPort) {
+	{
+		std::lock_guard<std::mutex> guard(pool_lock);
+		auto &clients = idle[protoHostPort];
+		if (!clients.empty()) {
+			auto client = std::move(clients.back());
+			clients.pop_back();
+			Count(CONNECTIONS_REUSED_METRIC);
+			return client;
+		}
+	}
+	Count(CONNECTIONS_OPENED_METRIC);
+	return http_util.InitializeClient(*params, protoHostPort);
 }
 
-DuckDBHttpClient::DuckDBHttpClient(ClientContext &context) {
-	throw NotImplementedException("DuckDBHttpClient: Waiting for HTTPUtil POST support");
+void DuckDBHttpClient::Release(const std::string &protoHostPort, std::unique_ptr<HTTPClient> client) {
+	if (!client || !params->keep_alive) {
+		return;
+	}
+	std::lock_guard<std::mutex> guard(pool_lock);
+	idle[protoHostPort].push_back(std::move(client));
 }
 
 HttpResponse DuckDBHttpClient::Execute(const HttpRequest &request) {
-	throw NotImplementedException("DuckDBHttpClient: Waiting for HTTPUtil POST support");
+	string path;
+	string proto_host_port;
+	HTTPUtil::DecomposeURL(request.url, path, proto_host_port);
+
+	HTTPHeaders headers;
+	bool has_content_type = false;
+	for (const auto &h : request.headers) {
+		has_content_type = has_content_type || StringUtil::CIEquals(h.first, "Content-Type");
+		headers.Insert(h.first, h.second);
+	}
+	if (!has_content_type && (request.method == HttpMethod::POST || request.method == HttpMethod::PUT)) {
+		headers.Insert("Content-Type", "application/json");
+	}
+
+	auto client = Acquire(proto_host_port);
+	auto body = const_data_ptr_cast(request.body.data());
+	unique_ptr<HTTPResponse> result;
+	// Response body of a POST, which HTTPUtil returns in the request
+	string post_body;
+	switch (request.method) {
+	case HttpMethod::GET: {
+		GetRequestInfo info(request.url, headers, *params, nullptr, nullptr);
+		result = http_util.SendRequest(info, client);
+		break;
+	}
+	case HttpMethod::POST: {
+		PostRequestInfo info(request.url, headers, *params, body, request.body.size());
+		result = http_util.SendRequest(info, client);
+		post_body = std::move(info.buffer_out);
+		break;
+	}
+	case HttpMethod::PUT: {
+		PutRequestInfo info(request.url, headers, *params, body, request.body.size(),
+		                    headers.GetHeaderValue("Content-Type"));
+		result = http_util.SendRequest(info, client);
+		break;
+	}
+	case HttpMethod::DEL: {
+		DeleteRequestInfo info(request.url, headers, *params);
+		result = http_util.SendRequest(info, client);
+		break;
+	}
+	}
+	if (!result || result->HasRequestError()) {
+		throw IOException("HTTP request failed: %s", result ? result->GetRequestError() : string("no response"));
+	}
+
+	HttpResponse response;
+	response.statusCode = static_cast<int>(result->status);
+	response.body = post_body.empty() ? std::move(result->body) : std::move(post_body);
+	for (auto &h : result->headers) {
+		response.headers[h.first] = h.second;
+	}
+	// Failed requests throw above and drop their client, the server may have closed the connection
+	Release(proto_host_port, std::move(client));
+	return response;
 }
 
 } // namespace sheets
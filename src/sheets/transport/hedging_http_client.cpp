@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+
+#include "sheets/transport/hedging_http_client.hpp"
+#include "sheets/transport/http_executor.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+void LatencyTracker::Record(std::chrono::milliseconds latency) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (samples.size() < capacity) {
+		samples.push_back(latency);
+	} else {
+		samples[next] = latency;
+	}
+	next = (next + 1) % capacity;
+}
+
+size_t LatencyTracker::Count() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return samples.size();
+}
+
+std::chrono::milliseconds LatencyTracker::Percentile(double fraction) const {
+	std::vector<std::chrono::milliseconds> sorted;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		sorted = samples;
+	}
+	if (sorted.empty()) {
+		return std::chrono::milliseconds(0);
+	}
+	auto index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+	index = std::min(index, sorted.size() - 1);
+	std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(index), sorted.end());
+	return sorted[index];
+}
+
+void LatencyTracker::BeginRequest() {
+	std::lock_guard<std::mutex> guard(lock);
+	requestsInFlight++;
+}
+
+void LatencyTracker::EndRequest() {
+	std::lock_guard<std::mutex> guard(lock);
+	requestsInFlight--;
+}
+
+bool LatencyTracker::TryBeginHedge(double maxFraction) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto allowed = std::max(1.0, maxFraction * static_cast<double>(requestsInFlight));
+	if (static_cast<double>(hedgesInFlight + 1) > allowed) {
+		return false;
+	}
+	hedgesInFlight++;
+	return true;
+}
+
+void LatencyTracker::EndHedge() {
+	std::lock_guard<std::mutex> guard(lock);
+	hedgesInFlight--;
+}
+
+// Counts a GET as in flight for its lifetime
+class RequestInFlight {
+public:
+	explicit RequestInFlight(LatencyTracker &latencies) : latencies(latencies) {
+		latencies.BeginRequest();
+	}
+	~RequestInFlight() {
+		latencies.EndRequest();
+	}
+
+private:
+	LatencyTracker &latencies;
+};
+
+// First response of the original request and its hedge
+struct HedgingHttpClient::Race {
+	std::mutex lock;
+	std::condition_variable finished;
+	bool done = false;
+	// Set once the original request is sent, the hedging delay counts from then
+	bool started = false;
+	std::chrono::steady_clock::time_point dispatched;
+	std::vector<std::shared_ptr<std::atomic<bool>>> cancel_flags;
+	int launched = 0;
+	int failed = 0;
+	bool hedge_won = false;
+	HttpResponse response;
+	std::exception_ptr error;
+};
+
+// Runs both copies of a hedged request. Its threads only send requests, so callers that are themselves running on the
+// DefaultHttpExecutor can wait for them.
+static HttpExecutor &HedgeExecutor() {
+	static HttpExecutor executor(16);
+	return executor;
+}
+
+HedgingHttpClient::~HedgingHttpClient() {
+	std::unique_lock<std::mutex> guard(legs_lock);
+	legs_finished.wait(guard, [this]() { return running_legs == 0; });
+}
+
+// Sends one copy of the request on the HedgeExecutor, called with race->lock held
+void HedgingHttpClient::Launch(const HttpRequest &request, const std::shared_ptr<Race> &race, bool hedge) {
+	race->launched++;
+	HttpRequest leg = request;
+	leg.cancelled = std::make_shared<std::atomic<bool>>(false);
+	race->cancel_flags.push_back(leg.cancelled);
+	{
+		std::lock_guard<std::mutex> guard(legs_lock);
+		running_legs++;
+	}
+	// The future isn't kept, the leg reports to the race and the destructor waits for running_legs
+	auto latencies = this->latencies;
+	HedgeExecutor().Submit([this, race, leg, hedge, latencies]() {
+		auto dispatched = std::chrono::steady_clock::now();
+		if (!hedge) {
+			std::lock_guard<std::mutex> guard(race->lock);
+			race->started = true;
+			race->dispatched = dispatched;
+			race->finished.notify_all();
+		}
+		HttpResponse response;
+		std::exception_ptr error;
+		try {
+			response = inner->Execute(leg);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		auto latency =
+		    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - dispatched);
+		{
+			std::lock_guard<std::mutex> guard(race->lock);
+			if (!error && !race->done) {
+				race->done = true;
+				race->hedge_won = hedge;
+				race->response = std::move(response);
+				latencies->Record(latency);
+				race->finished.notify_all();
+			} else if (error) {
+				race->failed++;
+				// Fails once every copy failed, the first error is kept
+				if (!race->error) {
+					race->error = error;
+				}
+				if (!race->done && race->failed == race->launched) {
+					race->done = true;
+					race->finished.notify_all();
+				}
+			}
+		}
+		if (hedge) {
+			latencies->EndHedge();
+			if (scheduler) {
+				scheduler->Release();
+			}
+		}
+		// Last use of the client, which may be destroyed as soon as the lock is released
+		std::lock_guard<std::mutex> guard(legs_lock);
+		running_legs--;
+		legs_finished.notify_all();
+		return HttpResponse();
+	});
+}
+
+HttpResponse HedgingHttpClient::Execute(const HttpRequest &request) {
+	if (request.method != HttpMethod::GET) {
+		return inner->Execute(request);
+	}
+	RequestInFlight in_flight(*latencies);
+	if (latencies->Count() < options.minSamples) {
+		auto start = std::chrono::steady_clock::now();
+		auto response = inner->Execute(request);
+		latencies->Record(
+		    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start));
+		return response;
+	}
+	auto delay = latencies->Percentile(options.percentile);
+	delay = std::max(options.minDelay, std::min(delay, options.maxDelay));
+
+	auto race = std::make_shared<Race>();
+	std::unique_lock<std::mutex> guard(race->lock);
+	Launch(request, race, false);
+	// Time spent queued for a thread doesn't count towards the delay
+	race->finished.wait(guard, [&race]() { return race->started || race->done; });
+	race->finished.wait_until(guard, race->dispatched + delay,
+	                          [&race]() { return race->done || race->failed > 0; });
+	if (!race->done && race->failed == 0 && latencies->TryBeginHedge(options.maxHedgeFraction)) {
+		if (!scheduler || scheduler->TryAcquire(ClassifyRequest(request))) {
+			metrics.Increment(HEDGED_REQUESTS_METRIC);
+			Launch(request, race, true);
+		} else {
+			latencies->EndHedge();
+		}
+	}
+	race->finished.wait(guard, [&race]() { return race->done; });
+	// The copy still running is cancelled, the destructor waits for it
+	for (auto &flag : race->cancel_flags) {
+		*flag = true;
+	}
+	if (race->hedge_won) {
+		metrics.Increment(HEDGE_WINS_METRIC);
+	}
+	if (race->failed == race->launched) {
+		std::rethrow_exception(race->error);
+	}
+	return std::move(race->response);
+}
+
+} // namespace sheets
+} // namespace duckdb
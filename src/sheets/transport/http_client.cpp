@@ -1,9 +1,14 @@
 #include "sheets/transport/http_client.hpp"
+#include "sheets/transport/http_executor.hpp"
 #include "sheets/transport/http_type.hpp"
 
 namespace duckdb {
 namespace sheets {
 
+std::future<HttpResponse> IHttpClient::ExecuteAsync(const HttpRequest &request) {
+	return DefaultHttpExecutor().Submit([this, request]() { return Execute(request); });
+}
+
 HttpRequest IHttpClient::BuildRequest(const HttpMethod method, const std::string &url, const HttpHeaders &headers) {
 	return HttpRequest {method, url, headers, ""};
 }
@@ -0,0 +1,56 @@
+#include "sheets/transport/http_executor.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+HttpExecutor::~HttpExecutor() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	queued.notify_all();
+	for (auto &thread : threads) {
+		thread.join();
+	}
+}
+
+std::future<HttpResponse> HttpExecutor::Submit(std::function<HttpResponse()> task) {
+	std::packaged_task<HttpResponse()> packaged(std::move(task));
+	auto result = packaged.get_future();
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		tasks.push_back(std::move(packaged));
+		if (idleThreads < tasks.size() && threads.size() < maxThreads) {
+			threads.emplace_back(&HttpExecutor::Work, this);
+		}
+	}
+	queued.notify_one();
+	return result;
+}
+
+void HttpExecutor::Work() {
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		idleThreads++;
+		queued.wait(guard, [this]() { return stopping || !tasks.empty(); });
+		idleThreads--;
+		if (tasks.empty()) {
+			// Stopping, queued requests are run first
+			return;
+		}
+		auto task = std::move(tasks.front());
+		tasks.pop_front();
+		guard.unlock();
+		// Exceptions are stored in the future
+		task();
+		guard.lock();
+	}
+}
+
+HttpExecutor &DefaultHttpExecutor() {
+	static HttpExecutor executor;
+	return executor;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <thread>
+
 #include "duckdb/common/exception.hpp"
 
 #define CPPHTTPLIB_OPENSSL_SUPPORT
@@ -26,18 +32,170 @@ void HttpLibClient::ParseUrl(const std::string &url, std::string &baseUrl, std::
 	}
 }
 
-HttpResponse HttpLibClient::Execute(const HttpRequest &request) {
-	std::string baseUrl;
-	std::string path;
-	ParseUrl(request.url, baseUrl, path);
+// Stops requests past their deadline or cancelled by shutting down their connection's socket. The thread is started
+// with the first watched request and checks cancellation every 100ms.
+class HttpLibClient::Watchdog {
+public:
+	~Watchdog() {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		wake.notify_all();
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+
+	// Returns the id to pass to Remove
+	size_t Add(duckdb_httplib_openssl::Client &client, std::chrono::steady_clock::time_point deadline,
+	           std::shared_ptr<std::atomic<bool>> cancelled) {
+		std::lock_guard<std::mutex> guard(lock);
+		if (!thread.joinable()) {
+			thread = std::thread(&Watchdog::Run, this);
+		}
+		auto id = next_id++;
+		watched[id] = Watched {&client, deadline, std::move(cancelled), false, false};
+		wake.notify_all();
+		return id;
+	}
+
+	// Returns whether the request was stopped, and sets expired when it was stopped by its deadline
+	bool Remove(size_t id, bool &expired) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto entry = watched.find(id);
+		bool stopped = entry->second.stopped;
+		expired = entry->second.expired;
+		watched.erase(entry);
+		return stopped;
+	}
+
+private:
+	struct Watched {
+		duckdb_httplib_openssl::Client *client;
+		std::chrono::steady_clock::time_point deadline;
+		std::shared_ptr<std::atomic<bool>> cancelled;
+		bool stopped;
+		bool expired;
+	};
+
+	void Run() {
+		std::unique_lock<std::mutex> guard(lock);
+		while (!stopping) {
+			auto now = std::chrono::steady_clock::now();
+			auto next_check = now + std::chrono::seconds(60);
+			for (auto &entry : watched) {
+				auto &request = entry.second;
+				if (request.stopped) {
+					continue;
+				}
+				bool cancelled = request.cancelled && *request.cancelled;
+				if (cancelled || now >= request.deadline) {
+					request.stopped = true;
+					request.expired = !cancelled;
+					// Safe while the lock is held, the request is only removed under it
+					request.client->stop();
+					continue;
+				}
+				next_check = std::min(next_check, request.deadline);
+				if (request.cancelled) {
+					next_check = std::min(next_check, now + std::chrono::milliseconds(100));
+				}
+			}
+			wake.wait_until(guard, next_check);
+		}
+	}
+
+	std::mutex lock;
+	std::condition_variable wake;
+	std::thread thread;
+	bool stopping = false;
+	size_t next_id = 0;
+	std::map<size_t, Watched> watched;
+};
+
+HttpLibClient::HttpLibClient(HttpProxyConfig proxy_config, ConnectionPoolOptions pool_options,
+                             std::shared_ptr<Metrics> metrics, HttpTimeouts timeouts)
+    : proxy_config(std::move(proxy_config)), pool_options(pool_options), metrics(std::move(metrics)),
+      timeouts(timeouts), watchdog(new Watchdog()) {
+}
+
+template <class DURATION>
+static void SplitDuration(DURATION duration, time_t &seconds, time_t &microseconds) {
+	auto total = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+	seconds = static_cast<time_t>(total / 1000000);
+	microseconds = static_cast<time_t>(total % 1000000);
+}
+
+HttpLibClient::~HttpLibClient() {
+}
+
+void HttpLibClient::Count(const char *metric, int64_t delta) {
+	if (metrics) {
+		metrics->Increment(metric, delta);
+	}
+}
 
-	duckdb_httplib_openssl::Client client(baseUrl);
+std::unique_ptr<HttpLibClient::Connection> HttpLibClient::Acquire(const std::string &baseUrl) {
+	auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> guard(pool_lock);
+		auto &connections = idle[baseUrl];
+		while (!connections.empty()) {
+			auto connection = std::move(connections.back());
+			connections.pop_back();
+			if (now - connection->lastUsed < pool_options.idleTimeout) {
+				Count(CONNECTIONS_REUSED_METRIC);
+				return connection;
+			}
+			// The connections before it idled even longer
+			Count(CONNECTIONS_EXPIRED_METRIC, static_cast<int64_t>(connections.size() + 1));
+			connections.clear();
+		}
+	}
+
+	auto connection = std::unique_ptr<Connection>(new Connection());
+	connection->client = std::unique_ptr<duckdb_httplib_openssl::Client>(new duckdb_httplib_openssl::Client(baseUrl));
+	auto &client = *connection->client;
+	client.set_keep_alive(pool_options.keepAlive);
+	// Encoded bodies are passed through, CompressionHttpClient decodes them
+	client.set_decompress(false);
+	time_t seconds;
+	time_t microseconds;
+	SplitDuration(timeouts.connect, seconds, microseconds);
+	client.set_connection_timeout(seconds, microseconds);
+	SplitDuration(timeouts.read, seconds, microseconds);
+	client.set_read_timeout(seconds, microseconds);
+	client.set_write_timeout(seconds, microseconds);
 	if (!proxy_config.host.empty()) {
 		client.set_proxy(proxy_config.host, proxy_config.port);
 		if (!proxy_config.username.empty()) {
 			client.set_proxy_basic_auth(proxy_config.username, proxy_config.password);
 		}
 	}
+	Count(CONNECTIONS_OPENED_METRIC);
+	return connection;
+}
+
+void HttpLibClient::Release(const std::string &baseUrl, std::unique_ptr<Connection> connection) {
+	if (!pool_options.keepAlive) {
+		return;
+	}
+	connection->lastUsed = std::chrono::steady_clock::now();
+	std::lock_guard<std::mutex> guard(pool_lock);
+	auto &connections = idle[baseUrl];
+	if (connections.size() < pool_options.maxIdlePerHost) {
+		connections.push_back(std::move(connection));
+	}
+}
+
+HttpResponse HttpLibClient::Execute(const HttpRequest &request) {
+	std::string baseUrl;
+	std::string path;
+	ParseUrl(request.url, baseUrl, path);
+
+	auto connection = Acquire(baseUrl);
+	auto &client = *connection->client;
 
 	// Extract content-type from request headers (default to application/json)
 	std::string contentType = "application/json";
@@ -50,8 +208,16 @@ HttpResponse HttpLibClient::Execute(const HttpRequest &request) {
 		}
 	}
 
-	duckdb_httplib_openssl::Result result;
+	// Without a total timeout or a way to cancel, the read and write timeouts are enough
+	bool watched = timeouts.total.count() > 0 || request.cancelled;
+	size_t watch_id = 0;
+	if (watched) {
+		auto deadline = timeouts.total.count() > 0 ? std::chrono::steady_clock::now() + timeouts.total
+		                                           : std::chrono::steady_clock::time_point::max();
+		watch_id = watchdog->Add(client, deadline, request.cancelled);
+	}
 
+	duckdb_httplib_openssl::Result result;
 	switch (request.method) {
 
 	case HttpMethod::GET:
@@ -68,17 +234,29 @@ HttpResponse HttpLibClient::Execute(const HttpRequest &request) {
 		break;
 	}
 
-	HttpResponse response;
-
+	bool stopped = false;
+	bool timed_out = false;
+	if (watched) {
+		stopped = watchdog->Remove(watch_id, timed_out);
+	}
+	if (timed_out) {
+		throw duckdb::IOException("HTTP request timed out after " + std::to_string(timeouts.total.count()) + " ms");
+	}
+	if (stopped) {
+		throw duckdb::IOException("HTTP request cancelled");
+	}
 	if (!result) {
 		throw duckdb::IOException("HTTP request failed: " + duckdb_httplib_openssl::to_string(result.error()));
 	}
 
+	HttpResponse response;
 	response.statusCode = result->status;
-	response.body = result->body;
+	response.body = std::move(result->body);
 	for (const auto &h : result->headers) {
 		response.headers[h.first] = h.second;
 	}
+	// Failed requests throw above and drop their connection, the server may have closed it
+	Release(baseUrl, std::move(connection));
 	return response;
 }
 
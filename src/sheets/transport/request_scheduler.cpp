@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cmath>
+
+#include "sheets/transport/request_scheduler.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+RequestClass ClassifyRequest(const HttpRequest &request) {
+	auto scheme_end = request.url.find("://");
+	auto host_start = scheme_end == std::string::npos ? 0 : scheme_end + 3;
+	auto host = request.url.substr(host_start, request.url.find('/', host_start) - host_start);
+	if (host != "sheets.googleapis.com") {
+		return RequestClass::UNMETERED;
+	}
+	return request.method == HttpMethod::GET ? RequestClass::READ : RequestClass::WRITE;
+}
+
+void TokenBucket::Configure(int64_t perMinute, int64_t burstSeconds, Clock::time_point now) {
+	// Tokens refilled so far count at the old rate
+	bool was_limited = configured && !Unlimited();
+	if (was_limited) {
+		Ready(now);
+	}
+	this->perMinute = perMinute;
+	capacity = std::max(1.0, static_cast<double>(perMinute) * static_cast<double>(burstSeconds) / 60.0);
+	// Start full when no quota was tracked yet
+	tokens = was_limited ? std::min(tokens, capacity) : capacity;
+	refilled = now;
+	configured = true;
+}
+
+bool TokenBucket::Ready(Clock::time_point now) {
+	if (Unlimited()) {
+		return true;
+	}
+	auto elapsed = std::chrono::duration<double>(now - refilled).count();
+	tokens = std::min(capacity, tokens + elapsed * static_cast<double>(perMinute) / 60.0);
+	refilled = now;
+	return tokens >= 1.0;
+}
+
+void TokenBucket::Take() {
+	if (!Unlimited()) {
+		tokens -= 1.0;
+	}
+}
+
+std::chrono::microseconds TokenBucket::UntilReady() const {
+	if (Unlimited() || tokens >= 1.0) {
+		return std::chrono::microseconds(0);
+	}
+	auto seconds = (1.0 - tokens) * 60.0 / static_cast<double>(perMinute);
+	return std::chrono::microseconds(static_cast<int64_t>(std::ceil(seconds * 1e6)));
+}
+
+RequestScheduler::RequestScheduler(SchedulerOptions options) {
+	Configure(options);
+}
+
+void RequestScheduler::Configure(const SchedulerOptions &options) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto now = TokenBucket::Clock::now();
+		this->options = options;
+		reads.Configure(options.readsPerMinute, options.burstSeconds, now);
+		writes.Configure(options.writesPerMinute, options.burstSeconds, now);
+	}
+	changed.notify_all();
+}
+
+TokenBucket *RequestScheduler::Bucket(RequestClass requestClass) {
+	switch (requestClass) {
+	case RequestClass::READ:
+		return &reads;
+	case RequestClass::WRITE:
+		return &writes;
+	default:
+		return nullptr;
+	}
+}
+
+void RequestScheduler::Acquire(RequestClass requestClass) {
+	auto index = static_cast<size_t>(requestClass);
+	std::unique_lock<std::mutex> guard(lock);
+	auto ticket = nextTicket[index]++;
+	while (true) {
+		auto now = TokenBucket::Clock::now();
+		auto bucket = Bucket(requestClass);
+		bool turn = ticket == servingTicket[index];
+		bool slot = options.maxInFlight == 0 || inFlight < options.maxInFlight;
+		// Writes leave free slots to reads that can go, reads are interactive and writes are bulk
+		auto read_index = static_cast<size_t>(RequestClass::READ);
+		bool reads_waiting = nextTicket[read_index] != servingTicket[read_index];
+		bool yield = requestClass == RequestClass::WRITE && reads_waiting && reads.Ready(now);
+		if (turn && slot && !yield) {
+			if (!bucket || bucket->Ready(now)) {
+				break;
+			}
+			changed.wait_for(guard, bucket->UntilReady());
+		} else {
+			changed.wait(guard);
+		}
+	}
+	auto bucket = Bucket(requestClass);
+	if (bucket) {
+		bucket->Take();
+	}
+	servingTicket[index]++;
+	inFlight++;
+	guard.unlock();
+	// The next ticket of the class may be admitted too
+	changed.notify_all();
+}
+
+bool RequestScheduler::TryAcquire(RequestClass requestClass) {
+	auto index = static_cast<size_t>(requestClass);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		bool waiting = nextTicket[index] != servingTicket[index];
+		bool slot = options.maxInFlight == 0 || inFlight < options.maxInFlight;
+		auto bucket = Bucket(requestClass);
+		if (waiting || !slot || (bucket && !bucket->Ready(TokenBucket::Clock::now()))) {
+			return false;
+		}
+		if (bucket) {
+			bucket->Take();
+		}
+		nextTicket[index]++;
+		servingTicket[index]++;
+		inFlight++;
+	}
+	return true;
+}
+
+void RequestScheduler::Release() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		inFlight--;
+	}
+	changed.notify_all();
+}
+
+size_t RequestScheduler::InFlight() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return inFlight;
+}
+
+HttpResponse SchedulingHttpClient::Execute(const HttpRequest &request) {
+	auto start = std::chrono::steady_clock::now();
+	scheduler->Acquire(ClassifyRequest(request));
+	auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	if (waited.count() > 0) {
+		metrics.Increment(SCHEDULER_WAITS_METRIC);
+		metrics.Increment(SCHEDULER_WAIT_MS_METRIC, waited.count());
+	}
+	struct Admission {
+		RequestScheduler &scheduler;
+		~Admission() {
+			scheduler.Release();
+		}
+	} admission {*scheduler};
+	return inner->Execute(request);
+}
+
+} // namespace sheets
+} // namespace duckdb
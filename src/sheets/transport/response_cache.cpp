@@ -0,0 +1,115 @@
+#include <iterator>
+
+#include "sheets/transport/response_cache.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Approximate memory held by an entry
+static size_t EntrySize(const std::string &key, const ResponseCache::Entry &entry) {
+	size_t size = key.size() + entry.response.body.size() + entry.spreadsheetId.size() + entry.version.size();
+	for (auto &header : entry.response.headers) {
+		size += header.first.size() + header.second.size();
+	}
+	return size;
+}
+
+bool ResponseCache::Get(const std::string &key, Entry &entry) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto slot = slots.find(key);
+	if (slot == slots.end()) {
+		return false;
+	}
+	recency.splice(recency.begin(), recency, slot->second.position);
+	entry = slot->second.entry;
+	return true;
+}
+
+size_t ResponseCache::Put(const std::string &key, Entry entry) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto existing = slots.find(key);
+	if (existing != slots.end()) {
+		RemoveSlot(existing);
+	}
+	size_t size = EntrySize(key, entry);
+	if (size > maxBytes) {
+		return 0;
+	}
+	recency.push_front(key);
+	slots[key] = Slot {std::move(entry), size, recency.begin()};
+	bytes += size;
+	return EvictToBudget();
+}
+
+void ResponseCache::Remove(const std::string &key) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto slot = slots.find(key);
+	if (slot != slots.end()) {
+		RemoveSlot(slot);
+	}
+}
+
+void ResponseCache::RemoveSpreadsheet(const std::string &spreadsheetId) {
+	std::lock_guard<std::mutex> guard(lock);
+	for (auto slot = slots.begin(); slot != slots.end();) {
+		auto next = std::next(slot);
+		if (slot->second.entry.spreadsheetId == spreadsheetId) {
+			RemoveSlot(slot);
+		}
+		slot = next;
+	}
+}
+
+size_t ResponseCache::Clear() {
+	std::lock_guard<std::mutex> guard(lock);
+	size_t count = slots.size();
+	slots.clear();
+	recency.clear();
+	bytes = 0;
+	unversioned.clear();
+	return count;
+}
+
+void ResponseCache::MarkUnversioned(const std::string &key) {
+	std::lock_guard<std::mutex> guard(lock);
+	unversioned.insert(key);
+}
+
+bool ResponseCache::IsUnversioned(const std::string &key) const {
+	std::lock_guard<std::mutex> guard(lock);
+	return unversioned.count(key) > 0;
+}
+
+size_t ResponseCache::SetMaxBytes(size_t maxBytes_p) {
+	std::lock_guard<std::mutex> guard(lock);
+	maxBytes = maxBytes_p;
+	return EvictToBudget();
+}
+
+size_t ResponseCache::EntryCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return slots.size();
+}
+
+size_t ResponseCache::ByteCount() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return bytes;
+}
+
+void ResponseCache::RemoveSlot(std::unordered_map<std::string, Slot>::iterator slot) {
+	bytes -= slot->second.size;
+	recency.erase(slot->second.position);
+	slots.erase(slot);
+}
+
+size_t ResponseCache::EvictToBudget() {
+	size_t evicted = 0;
+	while (bytes > maxBytes && !recency.empty()) {
+		RemoveSlot(slots.find(recency.back()));
+		evicted++;
+	}
+	return evicted;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <thread>
+
+#include "sheets/transport/retry_http_client.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+bool IsRetryableStatus(int statusCode) {
+	switch (statusCode) {
+	case 408:
+	case 429:
+	case 500:
+	case 502:
+	case 503:
+	case 504:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool IsIdempotentRequest(const HttpRequest &request) {
+	if (request.method != HttpMethod::POST) {
+		return true;
+	}
+	auto path_end = request.url.find('?');
+	auto path = request.url.substr(0, path_end);
+	auto ends_with = [&path](const std::string &suffix) {
+		return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+	};
+	// Clearing twice clears the same cells, asking for a token twice returns another valid token
+	return ends_with(":clear") || ends_with(":batchClear") || ends_with("oauth2.googleapis.com/token");
+}
+
+int64_t RetryAfterMilliseconds(const HttpHeaders &headers) {
+	for (auto &header : headers) {
+		auto &name = header.first;
+		std::string lower(name.size(), ' ');
+		std::transform(name.begin(), name.end(), lower.begin(),
+		               [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+		if (lower != "retry-after") {
+			continue;
+		}
+		// Only the delay-seconds form, Google APIs don't send HTTP dates
+		auto &value = header.second;
+		auto is_digit = [](char c) {
+			return std::isdigit(static_cast<unsigned char>(c));
+		};
+		if (value.empty() || value.size() > 9 || !std::all_of(value.begin(), value.end(), is_digit)) {
+			return -1;
+		}
+		return std::stoll(value) * 1000;
+	}
+	return -1;
+}
+
+RetryHttpClient::RetryHttpClient(std::unique_ptr<IHttpClient> inner, Metrics &metrics, RetryOptions options)
+    : inner(std::move(inner)), metrics(metrics), options(std::move(options)), random(std::random_device {}()) {
+	if (!this->options.sleep) {
+		this->options.sleep = [](std::chrono::milliseconds delay) { std::this_thread::sleep_for(delay); };
+	}
+}
+
+std::chrono::milliseconds RetryHttpClient::Backoff(int attempt) {
+	auto backoff = options.initialBackoff.count();
+	for (int i = 0; i < attempt && backoff < options.maxBackoff.count(); i++) {
+		backoff *= 2;
+	}
+	backoff = std::min<int64_t>(backoff, options.maxBackoff.count());
+	std::lock_guard<std::mutex> guard(random_lock);
+	std::uniform_int_distribution<int64_t> jitter(backoff / 2, backoff);
+	return std::chrono::milliseconds(jitter(random));
+}
+
+void RetryHttpClient::Wait(std::chrono::milliseconds delay) {
+	metrics.Increment(RETRIES_METRIC);
+	metrics.Increment(RETRY_WAIT_MS_METRIC, delay.count());
+	options.sleep(delay);
+}
+
+HttpResponse RetryHttpClient::Execute(const HttpRequest &request) {
+	bool idempotent = IsIdempotentRequest(request);
+	for (int attempt = 0;; attempt++) {
+		bool last_attempt = attempt >= options.maxRetries;
+		HttpResponse response;
+		try {
+			response = inner->Execute(request);
+		} catch (std::exception &) {
+			// The request may have reached the server before the connection failed
+			if (!idempotent) {
+				throw;
+			}
+			if (last_attempt) {
+				if (options.maxRetries > 0) {
+					metrics.Increment(RETRIES_EXHAUSTED_METRIC);
+				}
+				throw;
+			}
+			Wait(Backoff(attempt));
+			continue;
+		}
+		// A 429 is rejected before it is applied, other failures of a non-idempotent request may have been applied
+		bool retryable = IsRetryableStatus(response.statusCode) && (idempotent || response.statusCode == 429);
+		if (!retryable) {
+			return response;
+		}
+		if (last_attempt) {
+			if (options.maxRetries > 0) {
+				metrics.Increment(RETRIES_EXHAUSTED_METRIC);
+			}
+			return response;
+		}
+		auto retry_after = RetryAfterMilliseconds(response.headers);
+		auto delay = retry_after >= 0
+		                 ? std::chrono::milliseconds(std::min<int64_t>(retry_after, options.maxBackoff.count()))
+		                 : Backoff(attempt);
+		Wait(delay);
+	}
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,169 @@
+#include <cstdint>
+#include <vector>
+
+#include "json.hpp"
+
+#include "sheets/exception.hpp"
+#include "sheets/util/cell_decoder.hpp"
+
+using json = nlohmann::json;
+
+namespace duckdb {
+namespace sheets {
+
+namespace {
+
+// Builds CellRanges from SAX events. The decoder keeps a stack of the containers it is inside of and only acts
+// on the ones it knows about, everything else (error details, unknown fields) is skipped.
+class CellRangeDecoder : public nlohmann::json_sax<json> {
+public:
+	CellRangeDecoder(std::vector<CellRange> &ranges, std::string &spreadsheet_id, bool batch)
+	    : ranges(ranges), spreadsheet_id(spreadsheet_id), batch(batch) {
+	}
+
+	bool null() override {
+		if (Top() == Scope::ROW) {
+			ranges.back().values.AddEmpty();
+		}
+		return true;
+	}
+
+	bool boolean(bool val) override {
+		if (Top() == Scope::ROW) {
+			ranges.back().values.AddBoolean(val);
+		}
+		return true;
+	}
+
+	bool number_integer(number_integer_t val) override {
+		return AddNumber(static_cast<double>(val));
+	}
+
+	bool number_unsigned(number_unsigned_t val) override {
+		return AddNumber(static_cast<double>(val));
+	}
+
+	bool number_float(number_float_t val, const string_t &) override {
+		return AddNumber(val);
+	}
+
+	bool string(string_t &val) override {
+		if (Top() == Scope::ROW) {
+			// Copied straight from the lexer's buffer into the arena
+			ranges.back().values.AddString(val.data(), val.size());
+			return true;
+		}
+		if (Top() == Scope::RANGE) {
+			if (current_key == "range") {
+				ranges.back().range = val;
+			} else if (current_key == "majorDimension") {
+				ranges.back().majorDimension = json(val).get<MajorDimension>();
+			}
+		} else if (Top() == Scope::BATCH && current_key == "spreadsheetId") {
+			spreadsheet_id = val;
+		}
+		return true;
+	}
+
+	bool binary(binary_t &) override {
+		return true;
+	}
+
+	bool start_object(std::size_t) override {
+		if (scopes.empty()) {
+			if (!batch) {
+				ranges.emplace_back();
+			}
+			scopes.push_back(batch ? Scope::BATCH : Scope::RANGE);
+		} else if (Top() == Scope::VALUE_RANGES) {
+			ranges.emplace_back();
+			scopes.push_back(Scope::RANGE);
+		} else {
+			scopes.push_back(Scope::SKIP);
+		}
+		return true;
+	}
+
+	bool end_object() override {
+		scopes.pop_back();
+		return true;
+	}
+
+	bool start_array(std::size_t) override {
+		if (Top() == Scope::RANGE && current_key == "values") {
+			scopes.push_back(Scope::VALUES);
+		} else if (Top() == Scope::VALUES) {
+			ranges.back().values.AddLine();
+			scopes.push_back(Scope::ROW);
+		} else if (Top() == Scope::BATCH && current_key == "valueRanges") {
+			scopes.push_back(Scope::VALUE_RANGES);
+		} else {
+			scopes.push_back(Scope::SKIP);
+		}
+		return true;
+	}
+
+	bool end_array() override {
+		scopes.pop_back();
+		return true;
+	}
+
+	bool key(string_t &val) override {
+		current_key.swap(val);
+		return true;
+	}
+
+	bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex) override {
+		throw SheetsParseException("Failed to parse response: " + std::string(ex.what()));
+	}
+
+private:
+	enum class Scope : uint8_t { BATCH, VALUE_RANGES, RANGE, VALUES, ROW, SKIP };
+
+	Scope Top() const {
+		return scopes.empty() ? Scope::SKIP : scopes.back();
+	}
+
+	bool AddNumber(double val) {
+		if (Top() == Scope::ROW) {
+			ranges.back().values.AddNumber(val);
+		}
+		return true;
+	}
+
+	std::vector<CellRange> &ranges;
+	std::string &spreadsheet_id;
+	bool batch;
+	std::vector<Scope> scopes;
+	// Key of the value being parsed within the current object
+	std::string current_key;
+};
+
+void Decode(const std::string &body, std::vector<CellRange> &ranges, std::string &spreadsheet_id, bool batch) {
+	CellRangeDecoder decoder(ranges, spreadsheet_id, batch);
+	json::sax_parse(body, &decoder);
+	for (auto &range : ranges) {
+		range.values.ShrinkToFit();
+	}
+}
+
+} // namespace
+
+CellRange DecodeCellRange(const std::string &body) {
+	std::vector<CellRange> ranges;
+	std::string spreadsheet_id;
+	Decode(body, ranges, spreadsheet_id, false);
+	if (ranges.empty()) {
+		throw SheetsParseException("Failed to parse response: expected a value range");
+	}
+	return std::move(ranges[0]);
+}
+
+BatchGetCellsResponse DecodeBatchGetCells(const std::string &body) {
+	BatchGetCellsResponse response;
+	Decode(body, response.valueRanges, response.spreadsheetId, true);
+	return response;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,67 @@
+#include "sheets/util/csv.hpp"
+#include "sheets/exception.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+std::vector<std::vector<std::string>> ParseCsv(const std::string &text) {
+	std::vector<std::vector<std::string>> rows;
+	std::vector<std::string> row;
+	std::string field;
+	bool in_quotes = false;
+	// Set once the current row has any content, so that a trailing line break doesn't add an empty row
+	bool row_started = false;
+
+	for (size_t i = 0; i < text.size(); i++) {
+		char c = text[i];
+		if (in_quotes) {
+			if (c != '"') {
+				field += c;
+			} else if (i + 1 < text.size() && text[i + 1] == '"') {
+				field += '"';
+				i++;
+			} else {
+				in_quotes = false;
+			}
+			continue;
+		}
+		switch (c) {
+		case '"':
+			in_quotes = true;
+			row_started = true;
+			break;
+		case ',':
+			row.push_back(std::move(field));
+			field.clear();
+			row_started = true;
+			break;
+		case '\r':
+			break;
+		case '\n':
+			if (row_started) {
+				row.push_back(std::move(field));
+				rows.push_back(std::move(row));
+			}
+			field.clear();
+			row.clear();
+			row_started = false;
+			break;
+		default:
+			field += c;
+			row_started = true;
+			break;
+		}
+	}
+
+	if (in_quotes) {
+		throw SheetsParseException("Failed to parse CSV: unterminated quoted field");
+	}
+	if (row_started) {
+		row.push_back(std::move(field));
+		rows.push_back(std::move(row));
+	}
+	return rows;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,63 @@
+#include <zlib.h>
+
+#include "sheets/exception.hpp"
+#include "sheets/util/gzip.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+// Window bits for a gzip header, and for detecting either a gzip or a zlib header
+static constexpr int GZIP_WINDOW_BITS = 15 + 16;
+static constexpr int DETECT_WINDOW_BITS = 15 + 32;
+static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+std::string GzipCompress(const std::string &data) {
+	z_stream stream = {};
+	if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		throw SheetsException("Failed to initialize gzip compression");
+	}
+	std::string result;
+	result.resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+	stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	stream.next_out = reinterpret_cast<Bytef *>(&result[0]);
+	stream.avail_out = static_cast<uInt>(result.size());
+	int status = deflate(&stream, Z_FINISH);
+	deflateEnd(&stream);
+	if (status != Z_STREAM_END) {
+		throw SheetsException("Failed to gzip compress " + std::to_string(data.size()) + " bytes");
+	}
+	result.resize(stream.total_out);
+	return result;
+}
+
+std::string GzipDecompress(const std::string &data) {
+	z_stream stream = {};
+	if (inflateInit2(&stream, DETECT_WINDOW_BITS) != Z_OK) {
+		throw SheetsException("Failed to initialize gzip decompression");
+	}
+	std::string result;
+	stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	int status = Z_OK;
+	while (status == Z_OK) {
+		// Responses are JSON and usually compress several times over
+		size_t offset = result.size();
+		result.resize(offset + (offset == 0 ? data.size() * 4 + CHUNK_SIZE : offset));
+		stream.next_out = reinterpret_cast<Bytef *>(&result[offset]);
+		stream.avail_out = static_cast<uInt>(result.size() - offset);
+		status = inflate(&stream, Z_NO_FLUSH);
+		if (status == Z_BUF_ERROR && stream.avail_in > 0) {
+			status = Z_OK;
+		}
+	}
+	inflateEnd(&stream);
+	if (status != Z_STREAM_END) {
+		throw SheetsParseException("Invalid gzip response body");
+	}
+	result.resize(stream.total_out);
+	return result;
+}
+
+} // namespace sheets
+} // namespace duckdb
@@ -0,0 +1,94 @@
+#include "utils/settings.hpp"
+
+#include "sheets/transport/disk_response_store.hpp"
+#include "sheets/transport/response_cache.hpp"
+
+namespace duckdb {
+namespace sheets {
+
+void RegisterSettings(DBConfig &config) {
+	config.AddExtensionOption(MAX_CONCURRENCY_SETTING, "Maximum number of concurrent requests when reading a sheet",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_MAX_CONCURRENCY));
+	config.AddExtensionOption(CACHE_TTL_SETTING,
+	                          "Seconds a read_gsheet response is served from the response cache, 0 disables the cache",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_CACHE_TTL));
+	config.AddExtensionOption(METADATA_CACHE_TTL_SETTING,
+	                          "Seconds spreadsheet metadata is reused across statements, 0 to only reuse it within "
+	                          "a statement",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_METADATA_CACHE_TTL));
+	config.AddExtensionOption(CACHE_MAX_BYTES_SETTING, "Maximum number of bytes held by the response cache",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_CACHE_MAX_BYTES));
+	config.AddExtensionOption(CACHE_VALIDATE_SETTING,
+	                          "Check the spreadsheet's Drive version before serving a cached response",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption(HTTP_COMPRESSION_SETTING, "Request gzip encoded responses from the Google APIs",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption(COMPRESS_REQUESTS_SETTING, "Send request bodies (e.g. COPY TO) gzip encoded",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption(HTTP_CLIENT_SETTING,
+	                          "HTTP client sending the requests: 'httplib' (the extension's own), 'duckdb' (DuckDB's "
+	                          "HTTP client and settings) or 'curl' (libcurl with HTTP/2)",
+	                          LogicalType::VARCHAR, Value(DEFAULT_HTTP_CLIENT));
+	config.AddExtensionOption(HTTP_KEEP_ALIVE_SETTING, "Keep connections to the Google APIs open between requests",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption(HTTP_IDLE_TIMEOUT_SETTING, "Seconds an idle connection is kept open for reuse",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_IDLE_TIMEOUT));
+	config.AddExtensionOption(HTTP_CONNECT_TIMEOUT_SETTING, "Seconds to wait for a connection to the Google APIs",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_CONNECT_TIMEOUT));
+	config.AddExtensionOption(HTTP_READ_TIMEOUT_SETTING,
+	                          "Seconds to wait for data while reading a response from the Google APIs",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_READ_TIMEOUT));
+	config.AddExtensionOption(HTTP_TIMEOUT_SETTING, "Seconds a whole request may take, 0 for no limit",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_TIMEOUT));
+	config.AddExtensionOption(HTTP_HEDGING_SETTING,
+	                          "Send a GET a second time when it takes longer than 95% of recent ones, and use the "
+	                          "first response",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption(HTTP_RETRIES_SETTING,
+	                          "Retries of a request failing with a rate limit or server error, 0 disables retrying",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_RETRIES));
+	config.AddExtensionOption(HTTP_RETRY_MAX_WAIT_SETTING, "Longest wait in seconds before retrying a request",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_HTTP_RETRY_MAX_WAIT));
+	config.AddExtensionOption(READ_REQUESTS_PER_MINUTE_SETTING,
+	                          "Sheets API read requests per minute sent by all connections, 0 for no limit",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_READ_REQUESTS_PER_MINUTE));
+	config.AddExtensionOption(WRITE_REQUESTS_PER_MINUTE_SETTING,
+	                          "Sheets API write requests per minute sent by all connections, 0 for no limit",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_WRITE_REQUESTS_PER_MINUTE));
+	config.AddExtensionOption(MAX_REQUESTS_IN_FLIGHT_SETTING,
+	                          "Requests kept in flight by all connections together, 0 for no limit",
+	                          LogicalType::BIGINT, Value::BIGINT(DEFAULT_MAX_REQUESTS_IN_FLIGHT));
+	config.AddExtensionOption(CACHE_DIRECTORY_SETTING,
+	                          "Directory where read_gsheet responses are kept across restarts, empty to disable",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption(CACHE_DIRECTORY_MAX_BYTES_SETTING,
+	                          "Maximum number of bytes held by the cache directory", LogicalType::BIGINT,
+	                          Value::BIGINT(DEFAULT_DISK_CACHE_MAX_BYTES));
+}
+
+int64_t GetBigintSetting(ClientContext &ctx, const std::string &name, int64_t default_value) {
+	Value value;
+	if (!ctx.TryGetCurrentSetting(name, value) || value.IsNull()) {
+		return default_value;
+	}
+	return value.GetValue<int64_t>();
+}
+
+bool GetBooleanSetting(ClientContext &ctx, const std::string &name, bool default_value) {
+	Value value;
+	if (!ctx.TryGetCurrentSetting(name, value) || value.IsNull()) {
+		return default_value;
+	}
+	return value.GetValue<bool>();
+}
+
+std::string GetStringSetting(ClientContext &ctx, const std::string &name, const std::string &default_value) {
+	Value value;
+	if (!ctx.TryGetCurrentSetting(name, value) || value.IsNull()) {
+		return default_value;
+	}
+	return value.ToString();
+}
+
+} // namespace sheets
+} // namespace duckdb
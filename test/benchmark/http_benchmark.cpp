@@ -0,0 +1,94 @@
+// Compares the request latency of HttpLibClient, DuckDBHttpClient and CurlHttpClient against a local server answering with a JSON
+// body of the size of a 10k cell values response. GETs reuse connections with both clients; POSTs check the body
+// round trip. Build and run with `make bench_http`, CurlHttpClient is only measured when built with
+// GSHEETS_CURL_TRANSPORT.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "duckdb.hpp"
+
+#define CPPHTTPLIB_OPENSSL_SUPPORT
+#include "httplib.hpp"
+
+#ifdef GSHEETS_HAS_CURL
+#include "sheets/transport/curl_http_client.hpp"
+#endif
+#include "sheets/transport/duckdb_http_client.hpp"
+#include "sheets/transport/httplib_client.hpp"
+
+using namespace duckdb;
+
+static constexpr idx_t REQUEST_COUNT = 500;
+static constexpr idx_t BODY_BYTES = 200000;
+
+static double TimeRequests(sheets::IHttpClient &client, const std::string &url, sheets::HttpMethod method,
+                           const std::string &body) {
+	sheets::HttpRequest request;
+	request.method = method;
+	request.url = url;
+	request.headers["Content-Type"] = "application/json";
+	request.body = body;
+	auto start = std::chrono::steady_clock::now();
+	for (idx_t i = 0; i < REQUEST_COUNT; i++) {
+		auto response = client.Execute(request);
+		if (response.statusCode != 200 || response.body.size() != BODY_BYTES) {
+			fprintf(stderr, "unexpected response: %d, %llu bytes\n", response.statusCode,
+			        static_cast<unsigned long long>(response.body.size()));
+			exit(1);
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+	std::string payload = "{\"values\": [[\"";
+	payload += std::string(BODY_BYTES - payload.size() - 4, 'x');
+	payload += "\"]]}";
+
+	duckdb_httplib_openssl::Server server;
+	server.Get("/values", [&](const duckdb_httplib_openssl::Request &, duckdb_httplib_openssl::Response &res) {
+		res.set_content(payload, "application/json");
+	});
+	server.Post("/values", [&](const duckdb_httplib_openssl::Request &req, duckdb_httplib_openssl::Response &res) {
+		res.set_content(req.body, "application/json");
+	});
+	auto port = server.bind_to_any_port("127.0.0.1");
+	std::thread listener([&]() { server.listen_after_bind(); });
+	server.wait_until_ready();
+	auto url = "http://127.0.0.1:" + std::to_string(port) + "/values";
+
+	DuckDB db(nullptr);
+	Connection con(db);
+	sheets::HttpLibClient httplib_client(sheets::HttpProxyConfig {});
+	sheets::DuckDBHttpClient duckdb_client(*con.context);
+
+	auto httplib_get = TimeRequests(httplib_client, url, sheets::HttpMethod::GET, "");
+	auto duckdb_get = TimeRequests(duckdb_client, url, sheets::HttpMethod::GET, "");
+	auto httplib_post = TimeRequests(httplib_client, url, sheets::HttpMethod::POST, payload);
+	auto duckdb_post = TimeRequests(duckdb_client, url, sheets::HttpMethod::POST, payload);
+#ifdef GSHEETS_HAS_CURL
+	sheets::CurlHttpClient curl_client(sheets::HttpProxyConfig {});
+	auto curl_get = TimeRequests(curl_client, url, sheets::HttpMethod::GET, "");
+	auto curl_post = TimeRequests(curl_client, url, sheets::HttpMethod::POST, payload);
+#endif
+
+	server.stop();
+	listener.join();
+
+	printf("requests: %llu of %llu bytes\n", static_cast<unsigned long long>(REQUEST_COUNT),
+	       static_cast<unsigned long long>(BODY_BYTES));
+	printf("GET  httplib: %10.2f ms  %8.3f ms/request\n", httplib_get, httplib_get / REQUEST_COUNT);
+	printf("GET  duckdb:  %10.2f ms  %8.3f ms/request\n", duckdb_get, duckdb_get / REQUEST_COUNT);
+	printf("POST httplib: %10.2f ms  %8.3f ms/request\n", httplib_post, httplib_post / REQUEST_COUNT);
+	printf("POST duckdb:  %10.2f ms  %8.3f ms/request\n", duckdb_post, duckdb_post / REQUEST_COUNT);
+#ifdef GSHEETS_HAS_CURL
+	printf("GET  curl:    %10.2f ms  %8.3f ms/request\n", curl_get, curl_get / REQUEST_COUNT);
+	printf("POST curl:    %10.2f ms  %8.3f ms/request\n", curl_post, curl_post / REQUEST_COUNT);
+#endif
+	return 0;
+}
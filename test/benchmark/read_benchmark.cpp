@@ -0,0 +1,165 @@
+// Compares a per-cell Value conversion like the one read_gsheet used to do with the column writers in
+// gsheets_convert.cpp, from row-major and column-major cells, on an in-memory range of 1M cells. Also compares
+// the memory held by a vector of vectors of strings with the flat CellBuffer. Build and run with
+// `make bench_read`. The baseline is a reimplementation, not the old scan, so the speedup it reports only covers
+// the conversion and leaves out the rest of the scan.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+#include "gsheets_convert.hpp"
+
+using namespace duckdb;
+
+static constexpr idx_t ROW_COUNT = 100000;
+static constexpr idx_t COLUMN_COUNT = 10;
+
+using StringRows = std::vector<std::vector<std::string>>;
+
+// Mix of the types read_gsheet infers: numbers, booleans and text, with a few blank cells
+static StringRows MakeValues(vector<LogicalType> &types) {
+	for (idx_t col = 0; col < COLUMN_COUNT; col++) {
+		switch (col % 3) {
+		case 0:
+			types.push_back(LogicalType::DOUBLE);
+			break;
+		case 1:
+			types.push_back(LogicalType::BOOLEAN);
+			break;
+		default:
+			types.push_back(LogicalType::VARCHAR);
+			break;
+		}
+	}
+	StringRows values(ROW_COUNT);
+	for (idx_t row = 0; row < ROW_COUNT; row++) {
+		auto &cells = values[row];
+		cells.resize(COLUMN_COUNT);
+		for (idx_t col = 0; col < COLUMN_COUNT; col++) {
+			if ((row + col) % 17 == 0) {
+				continue;
+			}
+			switch (col % 3) {
+			case 0:
+				cells[col] = std::to_string(row * 0.25 + col);
+				break;
+			case 1:
+				cells[col] = row % 2 ? "TRUE" : "FALSE";
+				break;
+			default:
+				cells[col] = "name " + std::to_string(row) + " with a longer text value";
+				break;
+			}
+		}
+	}
+	return values;
+}
+
+// Heap bytes of a vector of vectors of strings, without allocator overhead. Short strings are stored inline.
+static idx_t StringRowsMemoryUsage(const StringRows &values) {
+	idx_t bytes = values.capacity() * sizeof(std::vector<std::string>);
+	for (auto &row : values) {
+		bytes += row.capacity() * sizeof(std::string);
+		for (auto &cell : row) {
+			if (cell.capacity() > std::string().capacity()) {
+				bytes += cell.capacity() + 1;
+			}
+		}
+	}
+	return bytes;
+}
+
+// Reimplements the conversion read_gsheet did before the column writers, one Value per cell and SetValue
+static void ConvertLegacy(const vector<LogicalType> &types, const std::vector<std::string> &row, idx_t row_idx,
+                          DataChunk &output) {
+	for (idx_t col = 0; col < output.ColumnCount(); col++) {
+		if (col >= row.size() || row[col].empty()) {
+			output.SetValue(col, row_idx, Value(types[col]));
+			continue;
+		}
+		const auto &value = row[col];
+		switch (types[col].id()) {
+		case LogicalTypeId::BOOLEAN:
+			output.SetValue(col, row_idx, Value(value).DefaultCastAs(LogicalType::BOOLEAN));
+			break;
+		case LogicalTypeId::DOUBLE:
+			output.SetValue(col, row_idx, Value(value).DefaultCastAs(LogicalType::DOUBLE));
+			break;
+		default:
+			output.SetValue(col, row_idx, Value(value));
+			break;
+		}
+	}
+}
+
+template <class FUNC>
+static double TimeScan(const vector<LogicalType> &types, FUNC convert_chunk) {
+	Allocator allocator;
+	DataChunk output;
+	output.Initialize(allocator, types);
+	auto start = std::chrono::steady_clock::now();
+	for (idx_t offset = 0; offset < ROW_COUNT; offset += STANDARD_VECTOR_SIZE) {
+		output.Reset();
+		idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, ROW_COUNT - offset);
+		convert_chunk(offset, count, output);
+		output.SetCardinality(count);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+	vector<LogicalType> types;
+	auto values = MakeValues(types);
+	idx_t cell_count = ROW_COUNT * COLUMN_COUNT;
+
+	// The same cells as read with majorDimension=ROWS and COLUMNS
+	SheetRows rows;
+	for (auto &row : values) {
+		rows.AddLine();
+		for (auto &cell : row) {
+			rows.AddString(cell.data(), cell.size());
+		}
+	}
+	rows.ShrinkToFit();
+	SheetColumns columns;
+	for (idx_t col = 0; col < COLUMN_COUNT; col++) {
+		columns.AddLine();
+		for (auto &row : values) {
+			columns.AddString(row[col].data(), row[col].size());
+		}
+	}
+	columns.ShrinkToFit();
+
+	auto legacy_ms = TimeScan(types, [&](idx_t offset, idx_t count, DataChunk &output) {
+		for (idx_t i = 0; i < count; i++) {
+			ConvertLegacy(types, values[offset + i], i, output);
+		}
+	});
+
+	vector<idx_t> cells;
+	for (idx_t col = 0; col < COLUMN_COUNT; col++) {
+		cells.push_back(col);
+	}
+	auto columnar_ms = TimeScan(types, [&](idx_t offset, idx_t count, DataChunk &output) {
+		ConvertSheetRows(types, cells, rows, 0, offset, count, output);
+	});
+	auto column_major_ms = TimeScan(types, [&](idx_t offset, idx_t count, DataChunk &output) {
+		ConvertSheetColumns(types, cells, columns, 0, offset, count, output);
+	});
+
+	printf("cells: %llu\n", static_cast<unsigned long long>(cell_count));
+	printf("per-cell Value: %10.2f ms  %8.2f Mcells/s\n", legacy_ms, cell_count / legacy_ms / 1000.0);
+	printf("column writers: %10.2f ms  %8.2f Mcells/s\n", columnar_ms, cell_count / columnar_ms / 1000.0);
+	printf("column-major:   %10.2f ms  %8.2f Mcells/s\n", column_major_ms, cell_count / column_major_ms / 1000.0);
+	printf("speedup:        %10.2fx (row-major) %.2fx (column-major)\n", legacy_ms / columnar_ms,
+	       legacy_ms / column_major_ms);
+	printf("memory, vector<vector<string>>: %8.2f MB\n", StringRowsMemoryUsage(values) / 1e6);
+	printf("memory, CellBuffer:             %8.2f MB\n", rows.MemoryUsage() / 1e6);
+	return 0;
+}
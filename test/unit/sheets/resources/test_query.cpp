@@ -0,0 +1,81 @@
+#include "catch.hpp"
+
+#include "sheets/auth/bearer_token_auth.hpp"
+#include "sheets/client.hpp"
+#include "sheets/exception.hpp"
+#include "sheets/resources/query.hpp"
+#include "sheets/transport/mock_http_client.hpp"
+
+// =============================================================================
+// QueryResource::Run Tests
+// =============================================================================
+
+TEST_CASE("QueryResource::Run returns CSV rows", "[query]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, "\"c1\",\"c3\"\n\"Alice\",\"Toronto\"\n\"Bob\",\"\"\n"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::QueryResource query(mockHttp, headers, "https://docs.google.com/spreadsheets/d", "spreadsheet123");
+
+	auto rows = query.Run("Sheet1", "A1:C9", 1, "select%20A%2C%20C");
+
+	REQUIRE(rows.size() == 3);
+	REQUIRE(rows[0][0] == "c1");
+	REQUIRE(rows[1][1] == "Toronto");
+	REQUIRE(rows[2][1] == "");
+}
+
+TEST_CASE("QueryResource::Run builds correct URL", "[query]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, ""});
+	mockHttp.AddResponse({200, {}, ""});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::QueryResource query(mockHttp, headers, "https://docs.google.com/spreadsheets/d", "spreadsheet123");
+
+	query.Run("Sheet1", "A1:C9", 1, "select%20A");
+	query.Run("My%20Sheet", "", 0, "select%20A");
+
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests.size() == 2);
+	REQUIRE(requests[0].url == "https://docs.google.com/spreadsheets/d/spreadsheet123/gviz/tq?tqx=out:csv"
+	                           "&sheet=Sheet1&range=A1:C9&headers=1&tq=select%20A");
+	REQUIRE(requests[0].method == duckdb::sheets::HttpMethod::GET);
+	REQUIRE(requests[1].url == "https://docs.google.com/spreadsheets/d/spreadsheet123/gviz/tq?tqx=out:csv"
+	                           "&sheet=My%20Sheet&headers=0&tq=select%20A");
+}
+
+TEST_CASE("QueryResource::Run throws SheetsApiException on HTTP error", "[query]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({400, {}, "Invalid query"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::QueryResource query(mockHttp, headers, "https://docs.google.com/spreadsheets/d", "spreadsheet123");
+
+	REQUIRE_THROWS_AS(query.Run("Sheet1", "", 1, "bad"), duckdb::sheets::SheetsApiException);
+}
+
+TEST_CASE("QueryResource::Run throws SheetsApiException on HTML response", "[query]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, "<!DOCTYPE html><html></html>"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::QueryResource query(mockHttp, headers, "https://docs.google.com/spreadsheets/d", "spreadsheet123");
+
+	REQUIRE_THROWS_AS(query.Run("Sheet1", "", 1, "select%20A"), duckdb::sheets::SheetsApiException);
+}
+
+TEST_CASE("GoogleSheetsClient sends queries to the query URL with auth headers", "[query]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, ""});
+
+	duckdb::sheets::BearerTokenAuth auth("token");
+	duckdb::sheets::GoogleSheetsClient client(mockHttp, auth, "http://localhost:8080/v4", "http://localhost:8080/d");
+
+	client.Query("abc123").Run("Sheet1", "", 1, "select%20A");
+
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests.size() == 1);
+	REQUIRE(requests[0].url.rfind("http://localhost:8080/d/abc123/gviz/tq?", 0) == 0);
+	REQUIRE(requests[0].headers.at("Authorization") == "Bearer token");
+}
@@ -63,7 +63,8 @@ TEST_CASE("SpreadsheetResource::Get builds correct URL", "[spreadsheet]") {
 
 	auto requests = mockHttp.GetRecordedRequests();
 	REQUIRE(requests.size() == 1);
-	REQUIRE(requests[0].url == "https://sheets.googleapis.com/v4/spreadsheets/abc123");
+	REQUIRE(requests[0].url == "https://sheets.googleapis.com/v4/spreadsheets/abc123"
+	                           "?fields=spreadsheetId,properties(title,locale,timeZone),sheets.properties");
 	REQUIRE(requests[0].method == duckdb::sheets::HttpMethod::GET);
 }
 
@@ -179,6 +180,47 @@ TEST_CASE("SpreadsheetResource::GetSheetByName throws when not found", "[spreads
 	REQUIRE_THROWS_AS(spreadsheet.GetSheetByName("NonExistent"), duckdb::sheets::SheetNotFoundException);
 }
 
+// =============================================================================
+// SpreadsheetResource::GetSheetsByPattern Tests
+// =============================================================================
+
+TEST_CASE("SpreadsheetResource::GetSheetsByPattern matches wildcards in sheet order", "[spreadsheet]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, MULTI_SHEET_RESPONSE});
+	mockHttp.AddResponse({200, {}, MULTI_SHEET_RESPONSE});
+	mockHttp.AddResponse({200, {}, MULTI_SHEET_RESPONSE});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::SpreadsheetResource spreadsheet(mockHttp, headers, "https://sheets.googleapis.com/v4", "abc123");
+
+	auto sheets = spreadsheet.GetSheetsByPattern({"Third", "*i*"});
+	REQUIRE(sheets.size() == 2);
+	REQUIRE(sheets[0].properties.title == "First");
+	REQUIRE(sheets[1].properties.title == "Third");
+
+	sheets = spreadsheet.GetSheetsByPattern({"S?cond", "F*t", "*d"});
+	REQUIRE(sheets.size() == 3);
+	REQUIRE(mockHttp.GetRecordedRequests().size() == 2);
+
+	REQUIRE(spreadsheet.GetSheetsByPattern({"Data_*"}).empty());
+}
+
+TEST_CASE("SpreadsheetResource::GetSheetsByPattern throws for a missing sheet name", "[spreadsheet]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, MULTI_SHEET_RESPONSE});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::SpreadsheetResource spreadsheet(mockHttp, headers, "https://sheets.googleapis.com/v4", "abc123");
+
+	REQUIRE_THROWS_AS(spreadsheet.GetSheetsByPattern({"First", "Fourth"}), duckdb::sheets::SheetNotFoundException);
+}
+
+TEST_CASE("IsSheetPattern detects wildcards", "[spreadsheet]") {
+	REQUIRE(duckdb::sheets::IsSheetPattern("Data_*"));
+	REQUIRE(duckdb::sheets::IsSheetPattern("Q?"));
+	REQUIRE_FALSE(duckdb::sheets::IsSheetPattern("Sheet1"));
+}
+
 // =============================================================================
 // SpreadsheetResource::GetSheetByIndex Tests
 // =============================================================================
@@ -225,3 +267,44 @@ TEST_CASE("SpreadsheetResource::CreateSheet returns new sheet", "[spreadsheet]")
 
 	REQUIRE(sheet.properties.title == "test1");
 }
+
+// =============================================================================
+// SpreadsheetResource::GetNumberFormatTypes Tests
+// =============================================================================
+
+TEST_CASE("SpreadsheetResource::GetNumberFormatTypes returns the first row's formats", "[spreadsheet]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({
+		"sheets": [{
+			"data": [{
+				"rowData": [{
+					"values": [
+						{"effectiveFormat": {"numberFormat": {"type": "DATE"}}},
+						{},
+						{"effectiveFormat": {"numberFormat": {"type": "DATE_TIME"}}}
+					]
+				}]
+			}]
+		}]
+	})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::SpreadsheetResource spreadsheet(mockHttp, headers, "https://sheets.googleapis.com/v4", "abc123");
+
+	auto types = spreadsheet.GetNumberFormatTypes(duckdb::sheets::A1Range("Sheet1!A2:C2"));
+
+	REQUIRE(types == std::vector<std::string> {"DATE", "", "DATE_TIME"});
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests[0].url == "https://sheets.googleapis.com/v4/spreadsheets/abc123?ranges=Sheet1!A2:C2"
+	                           "&fields=sheets.data.rowData.values.effectiveFormat.numberFormat.type");
+}
+
+TEST_CASE("SpreadsheetResource::GetNumberFormatTypes handles a blank row", "[spreadsheet]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({"sheets": [{"data": [{}]}]})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::SpreadsheetResource spreadsheet(mockHttp, headers, "https://sheets.googleapis.com/v4", "abc123");
+
+	REQUIRE(spreadsheet.GetNumberFormatTypes(duckdb::sheets::A1Range("Sheet1!A2:C2")).empty());
+}
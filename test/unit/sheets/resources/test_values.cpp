@@ -62,6 +62,157 @@ TEST_CASE("ValuesResource::Get throws SheetsParseException on invalid JSON", "[v
 	REQUIRE_THROWS_AS(values.Get(duckdb::sheets::A1Range("Sheet1!A1")), duckdb::sheets::SheetsParseException);
 }
 
+// =============================================================================
+// ValuesResource::GetCells Tests
+// =============================================================================
+
+TEST_CASE("ValuesResource::GetCells keeps cell types", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({
+		"range": "Sheet1!A1:D2",
+		"majorDimension": "ROWS",
+		"values": [["name", 1234.5, true, ""], ["Bob", 45292]]
+	})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	auto result = values.GetCells(duckdb::sheets::A1Range("Sheet1!A1:D2"), duckdb::sheets::UNFORMATTED_VALUE);
+
+	using Kind = duckdb::sheets::CellValue::Kind;
+	REQUIRE(result.values.LineCount() == 2);
+	REQUIRE(result.values.Get(0, 0).kind == Kind::STRING);
+	REQUIRE(result.values.Get(0, 0).Text() == "name");
+	REQUIRE(result.values.Get(0, 1).kind == Kind::NUMBER);
+	REQUIRE(result.values.Get(0, 1).number == 1234.5);
+	REQUIRE(result.values.Get(0, 2).kind == Kind::BOOLEAN);
+	REQUIRE(result.values.Get(0, 2).number == 1);
+	REQUIRE(result.values.Get(0, 3).IsEmpty());
+	REQUIRE(result.values.Get(1, 1).number == 45292);
+}
+
+TEST_CASE("ValuesResource::GetCells builds correct URL", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	for (int i = 0; i < 3; i++) {
+		mockHttp.AddResponse({200, {}, R"({"range": "", "values": []})"});
+	}
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	values.GetCells(duckdb::sheets::A1Range("Sheet1!A1:B2"));
+	values.GetCells(duckdb::sheets::A1Range("Sheet1!A1:B2"), duckdb::sheets::UNFORMATTED_VALUE);
+	values.GetCells(duckdb::sheets::A1Range("Sheet1!A1:B2"), duckdb::sheets::FORMATTED_VALUE,
+	                duckdb::sheets::COLUMNS);
+
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests.size() == 3);
+	REQUIRE(requests[0].url == "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values/Sheet1!A1:B2");
+	REQUIRE(requests[1].url == "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values/Sheet1!A1:B2"
+	                           "?valueRenderOption=UNFORMATTED_VALUE&dateTimeRenderOption=SERIAL_NUMBER");
+	REQUIRE(requests[2].url ==
+	        "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values/Sheet1!A1:B2?majorDimension=COLUMNS");
+}
+
+TEST_CASE("ValuesResource::GetCells reads columns", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({
+		"range": "Sheet1!A1:B3",
+		"majorDimension": "COLUMNS",
+		"values": [["a", "b", "c"], ["", 2]]
+	})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	auto result = values.GetCells(duckdb::sheets::A1Range("Sheet1!A1:B3"), duckdb::sheets::UNFORMATTED_VALUE,
+	                              duckdb::sheets::COLUMNS);
+
+	REQUIRE(result.majorDimension == duckdb::sheets::COLUMNS);
+	REQUIRE(result.values.LineCount() == 2);
+	REQUIRE(result.values.LineSize(0) == 3);
+	REQUIRE(result.values.Get(0, 2).Text() == "c");
+	REQUIRE(result.values.LineSize(1) == 2);
+	REQUIRE(result.values.Get(1, 0).IsEmpty());
+	REQUIRE(result.values.Get(1, 1).number == 2);
+}
+
+// =============================================================================
+// ValuesResource::BatchGetCells Tests
+// =============================================================================
+
+TEST_CASE("ValuesResource::BatchGetCells returns value ranges in request order", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({
+		"spreadsheetId": "spreadsheet123",
+		"valueRanges": [
+			{"range": "Sheet1!A1:A2", "majorDimension": "ROWS", "values": [["a"], ["c"]]},
+			{"range": "Sheet1!C1:D2", "majorDimension": "ROWS", "values": [["x", "y"]]}
+		]
+	})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	auto result =
+	    values.BatchGetCells({duckdb::sheets::A1Range("Sheet1!A1:A2"), duckdb::sheets::A1Range("Sheet1!C1:D2")});
+
+	REQUIRE(result.spreadsheetId == "spreadsheet123");
+	REQUIRE(result.valueRanges.size() == 2);
+	REQUIRE(result.valueRanges[0].values.LineCount() == 2);
+	REQUIRE(result.valueRanges[0].values.Get(1, 0).Text() == "c");
+	REQUIRE(result.valueRanges[1].range == "Sheet1!C1:D2");
+	REQUIRE(result.valueRanges[1].values.LineCount() == 1);
+	REQUIRE(result.valueRanges[1].values.Get(0, 1).Text() == "y");
+}
+
+TEST_CASE("ValuesResource::BatchGetCells builds correct URL", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({"spreadsheetId": "spreadsheet123", "valueRanges": []})"});
+	mockHttp.AddResponse({200, {}, R"({"spreadsheetId": "spreadsheet123", "valueRanges": []})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	values.BatchGetCells({duckdb::sheets::A1Range("Sheet1!A1:A2"), duckdb::sheets::A1Range("Sheet1!C1:D2")});
+	values.BatchGetCells({duckdb::sheets::A1Range("Sheet1!A1:A2")}, duckdb::sheets::UNFORMATTED_VALUE,
+	                     duckdb::sheets::COLUMNS);
+
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests.size() == 2);
+	REQUIRE(requests[0].url == "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/"
+	                           "values:batchGet?ranges=Sheet1!A1:A2&ranges=Sheet1!C1:D2");
+	REQUIRE(requests[0].method == duckdb::sheets::HttpMethod::GET);
+	REQUIRE(requests[1].url == "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values:batchGet"
+	                           "?ranges=Sheet1!A1:A2&valueRenderOption=UNFORMATTED_VALUE&dateTimeRenderOption=SERIAL_NUMBER"
+	                           "&majorDimension=COLUMNS");
+}
+
+TEST_CASE("ValuesResource::BatchGetCellsAsync decodes the response when the result is read", "[values]") {
+	duckdb::sheets::MockHttpClient mockHttp;
+	mockHttp.AddResponse({200, {}, R"({
+		"spreadsheetId": "spreadsheet123",
+		"valueRanges": [{"range": "Sheet1!A1:A2", "majorDimension": "ROWS", "values": [["a"], ["c"]]}]
+	})"});
+	mockHttp.AddResponse({404, {}, R"({"error": {"message": "Not found"}})"});
+
+	duckdb::sheets::HttpHeaders headers;
+	duckdb::sheets::ValuesResource values(mockHttp, headers, "https://sheets.googleapis.com/v4", "spreadsheet123");
+
+	auto result = values.BatchGetCellsAsync({duckdb::sheets::A1Range("Sheet1!A1:A2")}).get();
+	REQUIRE(result.valueRanges.size() == 1);
+	REQUIRE(result.valueRanges[0].values.Get(1, 0).Text() == "c");
+
+	auto failed = values.GetCellsAsync(duckdb::sheets::A1Range("Sheet1!A1"));
+	REQUIRE_THROWS_AS(failed.get(), duckdb::sheets::SheetsApiException);
+
+	auto requests = mockHttp.GetRecordedRequests();
+	REQUIRE(requests.size() == 2);
+	REQUIRE(requests[0].url ==
+	        "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values:batchGet?ranges=Sheet1!A1:A2");
+	REQUIRE(requests[1].url == "https://sheets.googleapis.com/v4/spreadsheets/spreadsheet123/values/Sheet1!A1");
+}
+
 // =============================================================================
 // ValuesResource::Update Tests
 // =============================================================================
@@ -0,0 +1,117 @@
+#include "catch.hpp"
+
+#include <cstring>
+
+#include "sheets/cell_buffer.hpp"
+
+using duckdb::sheets::CellBuffer;
+using Kind = duckdb::sheets::CellValue::Kind;
+
+static void AddText(CellBuffer &buffer, const char *text) {
+	buffer.AddString(text, strlen(text));
+}
+
+TEST_CASE("CellBuffer stores typed cells by line", "[cell_buffer]") {
+	CellBuffer buffer;
+	REQUIRE(buffer.Empty());
+
+	buffer.AddLine();
+	AddText(buffer, "name");
+	buffer.AddNumber(1.5);
+	buffer.AddBoolean(true);
+	buffer.AddLine();
+	buffer.AddLine();
+	AddText(buffer, "");
+	buffer.AddEmpty();
+	AddText(buffer, "last");
+
+	REQUIRE(buffer.LineCount() == 3);
+	REQUIRE(buffer.LineSize(0) == 3);
+	REQUIRE(buffer.LineSize(1) == 0);
+	REQUIRE(buffer.LineSize(2) == 3);
+	REQUIRE(buffer.LineSize(3) == 0);
+	REQUIRE(buffer.Get(0, 0).kind == Kind::STRING);
+	REQUIRE(buffer.Get(0, 0).Text() == "name");
+	REQUIRE(buffer.Get(0, 1).kind == Kind::NUMBER);
+	REQUIRE(buffer.Get(0, 1).number == 1.5);
+	REQUIRE(buffer.Get(0, 2).kind == Kind::BOOLEAN);
+	REQUIRE(buffer.Get(0, 2).number == 1);
+	REQUIRE(buffer.Get(1, 0).IsEmpty());
+	REQUIRE(buffer.Get(2, 0).IsEmpty());
+	REQUIRE(buffer.Get(2, 1).IsEmpty());
+	REQUIRE(buffer.Get(2, 2).Text() == "last");
+	REQUIRE(buffer.Get(2, 5).IsEmpty());
+	REQUIRE(buffer.MemoryUsage() > 0);
+}
+
+TEST_CASE("CellBuffer starts a line for a cell added first", "[cell_buffer]") {
+	CellBuffer buffer;
+	buffer.AddNumber(7);
+	REQUIRE(buffer.LineCount() == 1);
+	REQUIRE(buffer.Get(0, 0).number == 7);
+}
+
+TEST_CASE("CellBuffer removes and truncates lines", "[cell_buffer]") {
+	CellBuffer buffer;
+	for (int i = 0; i < 5; i++) {
+		buffer.AddLine();
+		AddText(buffer, std::to_string(i).c_str());
+	}
+
+	buffer.RemoveFirstLines(2);
+	REQUIRE(buffer.LineCount() == 3);
+	REQUIRE(buffer.Get(0, 0).Text() == "2");
+
+	buffer.Truncate(2);
+	REQUIRE(buffer.LineCount() == 2);
+	REQUIRE(buffer.Get(1, 0).Text() == "3");
+	REQUIRE(buffer.Get(2, 0).IsEmpty());
+
+	buffer.RemoveFirstLines(10);
+	REQUIRE(buffer.Empty());
+
+	buffer.Clear();
+	REQUIRE(buffer.Empty());
+	REQUIRE(buffer.MemoryUsage() == 0);
+}
+
+TEST_CASE("CellBuffer appends the lines of another buffer", "[cell_buffer]") {
+	CellBuffer first;
+	first.AddLine();
+	AddText(first, "a");
+
+	CellBuffer second;
+	second.AddLine();
+	AddText(second, "skipped");
+	second.AddLine();
+	AddText(second, "b");
+	second.AddNumber(2);
+	second.RemoveFirstLines(1);
+
+	first.AppendLines(second);
+	REQUIRE(first.LineCount() == 2);
+	REQUIRE(first.Get(0, 0).Text() == "a");
+	REQUIRE(first.Get(1, 0).Text() == "b");
+	REQUIRE(first.Get(1, 1).number == 2);
+}
+
+TEST_CASE("CellBuffer copies cells from another buffer", "[cell_buffer]") {
+	CellBuffer source;
+	AddText(source, "text");
+	source.AddNumber(3);
+	source.AddBoolean(false);
+	source.AddEmpty();
+
+	CellBuffer copy;
+	for (size_t i = 0; i < source.LineSize(0); i++) {
+		copy.AddCell(source.Get(0, i));
+	}
+	source.Clear();
+
+	REQUIRE(copy.LineSize(0) == 4);
+	REQUIRE(copy.Get(0, 0).Text() == "text");
+	REQUIRE(copy.Get(0, 1).number == 3);
+	REQUIRE(copy.Get(0, 2).kind == Kind::BOOLEAN);
+	REQUIRE(copy.Get(0, 2).number == 0);
+	REQUIRE(copy.Get(0, 3).IsEmpty());
+}
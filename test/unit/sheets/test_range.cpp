@@ -158,3 +158,94 @@ TEST_CASE("A1Range rejects double bang", "[range]") {
 	REQUIRE_FALSE(A1Range("Sheet1!!A1").IsValid());
 	REQUIRE_FALSE(A1Range("Sheet1!Sheet2!A1").IsValid());
 }
+
+// =============================================================================
+// GridBounds Tests
+// =============================================================================
+
+using duckdb::sheets::ColumnIndexToLetters;
+using duckdb::sheets::ColumnLettersToIndex;
+using duckdb::sheets::FormatRowWindow;
+using duckdb::sheets::GridBounds;
+using duckdb::sheets::ParseGridBounds;
+
+TEST_CASE("Column letters convert to and from indexes", "[range]") {
+	REQUIRE(ColumnLettersToIndex("A") == 1);
+	REQUIRE(ColumnLettersToIndex("z") == 26);
+	REQUIRE(ColumnLettersToIndex("AA") == 27);
+	REQUIRE(ColumnLettersToIndex("ZZ") == 702);
+	REQUIRE(ColumnIndexToLetters(1) == "A");
+	REQUIRE(ColumnIndexToLetters(26) == "Z");
+	REQUIRE(ColumnIndexToLetters(27) == "AA");
+	REQUIRE(ColumnIndexToLetters(703) == "AAA");
+}
+
+TEST_CASE("ParseGridBounds parses an empty range as the whole sheet", "[range]") {
+	GridBounds bounds;
+	REQUIRE(ParseGridBounds("", bounds));
+	REQUIRE_FALSE(bounds.HasColumns());
+	REQUIRE(bounds.startRow == 0);
+	REQUIRE(bounds.endRow == 0);
+}
+
+TEST_CASE("ParseGridBounds parses cell ranges", "[range]") {
+	GridBounds bounds;
+	REQUIRE(ParseGridBounds("B2:D7", bounds));
+	REQUIRE(bounds.startColumn == 2);
+	REQUIRE(bounds.startRow == 2);
+	REQUIRE(bounds.endColumn == 4);
+	REQUIRE(bounds.endRow == 7);
+
+	REQUIRE(ParseGridBounds("$A$1:$C$3", bounds));
+	REQUIRE(bounds.startColumn == 1);
+	REQUIRE(bounds.endRow == 3);
+
+	REQUIRE(ParseGridBounds("C7:A2", bounds));
+	REQUIRE(bounds.startColumn == 1);
+	REQUIRE(bounds.startRow == 2);
+	REQUIRE(bounds.endColumn == 3);
+	REQUIRE(bounds.endRow == 7);
+}
+
+TEST_CASE("ParseGridBounds parses open ended ranges", "[range]") {
+	GridBounds bounds;
+	REQUIRE(ParseGridBounds("A5:C", bounds));
+	REQUIRE(bounds.startRow == 5);
+	REQUIRE(bounds.endColumn == 3);
+	REQUIRE(bounds.endRow == 0);
+
+	REQUIRE(ParseGridBounds("A:C", bounds));
+	REQUIRE(bounds.startRow == 0);
+	REQUIRE(bounds.endRow == 0);
+
+	REQUIRE(ParseGridBounds("2:10", bounds));
+	REQUIRE_FALSE(bounds.HasColumns());
+	REQUIRE(bounds.startRow == 2);
+	REQUIRE(bounds.endRow == 10);
+}
+
+TEST_CASE("ParseGridBounds parses a single cell", "[range]") {
+	GridBounds bounds;
+	REQUIRE(ParseGridBounds("B3", bounds));
+	REQUIRE(bounds.startColumn == 2);
+	REQUIRE(bounds.endColumn == 2);
+	REQUIRE(bounds.startRow == 3);
+	REQUIRE(bounds.endRow == 3);
+}
+
+TEST_CASE("ParseGridBounds rejects named ranges and mixed forms", "[range]") {
+	GridBounds bounds;
+	REQUIRE_FALSE(ParseGridBounds("MyNamedRange", bounds));
+	REQUIRE_FALSE(ParseGridBounds("A", bounds));
+	REQUIRE_FALSE(ParseGridBounds("A1:5", bounds));
+	REQUIRE_FALSE(ParseGridBounds("A1:B2:C3", bounds));
+}
+
+TEST_CASE("FormatRowWindow keeps column bounds", "[range]") {
+	GridBounds bounds;
+	REQUIRE(ParseGridBounds("B2:D", bounds));
+	REQUIRE(FormatRowWindow(bounds, 10, 20) == "B10:D20");
+
+	REQUIRE(ParseGridBounds("", bounds));
+	REQUIRE(FormatRowWindow(bounds, 1, 500) == "1:500");
+}
@@ -0,0 +1,297 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "catch.hpp"
+
+#include "sheets/transport/caching_http_client.hpp"
+#include "sheets/transport/mock_http_client.hpp"
+
+using duckdb::sheets::CacheOptions;
+using duckdb::sheets::CachingHttpClient;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::MockHttpClient;
+using duckdb::sheets::ResponseCache;
+
+static const char *VALUES_URL = "https://sheets.googleapis.com/v4/spreadsheets/abc123/values/Sheet1!A1:B2";
+
+static HttpRequest Request(HttpMethod method, const std::string &url) {
+	HttpRequest request;
+	request.method = method;
+	request.url = url;
+	return request;
+}
+
+static CacheOptions Options(std::chrono::milliseconds ttl, bool validate = false) {
+	CacheOptions options;
+	options.ttl = ttl;
+	options.validate = validate;
+	return options;
+}
+
+// =============================================================================
+// Request classification Tests
+// =============================================================================
+
+TEST_CASE("SpreadsheetIdFromUrl finds the spreadsheet of API URLs", "[cache]") {
+	using duckdb::sheets::SpreadsheetIdFromUrl;
+	REQUIRE(SpreadsheetIdFromUrl(VALUES_URL) == "abc123");
+	REQUIRE(SpreadsheetIdFromUrl("https://sheets.googleapis.com/v4/spreadsheets/abc123:batchUpdate") == "abc123");
+	REQUIRE(SpreadsheetIdFromUrl("https://sheets.googleapis.com/v4/spreadsheets/abc123?fields=x") == "abc123");
+	REQUIRE(SpreadsheetIdFromUrl("https://docs.google.com/spreadsheets/d/abc123/gviz/tq?tq=select") == "abc123");
+	REQUIRE(SpreadsheetIdFromUrl("https://oauth2.googleapis.com/token") == "");
+}
+
+TEST_CASE("IsCacheableRead only accepts cell value reads", "[cache]") {
+	using duckdb::sheets::IsCacheableRead;
+	REQUIRE(IsCacheableRead(Request(HttpMethod::GET, VALUES_URL)));
+	REQUIRE(IsCacheableRead(
+	    Request(HttpMethod::GET, "https://sheets.googleapis.com/v4/spreadsheets/abc123/values:batchGet?ranges=A1")));
+	REQUIRE(IsCacheableRead(Request(HttpMethod::GET, "https://docs.google.com/spreadsheets/d/abc123/gviz/tq?tq=x")));
+	REQUIRE_FALSE(IsCacheableRead(Request(HttpMethod::GET, "https://sheets.googleapis.com/v4/spreadsheets/abc123")));
+	REQUIRE_FALSE(IsCacheableRead(Request(HttpMethod::POST, VALUES_URL)));
+}
+
+// =============================================================================
+// CachingHttpClient Tests
+// =============================================================================
+
+TEST_CASE("CachingHttpClient serves repeated reads from the cache", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "first"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::seconds(60)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "first");
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "first");
+
+	REQUIRE(mock->GetRecordedRequests().size() == 1);
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_MISSES_METRIC) == 1);
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_HITS_METRIC) == 1);
+	REQUIRE(cache->EntryCount() == 1);
+}
+
+TEST_CASE("CachingHttpClient passes through when the ttl is zero", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "first"});
+	mock->AddResponse({200, {}, "second"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::milliseconds(0)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "first");
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "second");
+	REQUIRE(cache->EntryCount() == 0);
+}
+
+TEST_CASE("CachingHttpClient doesn't cache errors", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({429, {}, "slow down"});
+	mock->AddResponse({200, {}, "ok"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::seconds(60)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).statusCode == 429);
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "ok");
+}
+
+TEST_CASE("CachingHttpClient refetches expired responses", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "first"});
+	mock->AddResponse({200, {}, "second"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::milliseconds(1)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "first");
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "second");
+	REQUIRE(cache->EntryCount() == 1);
+}
+
+TEST_CASE("CachingHttpClient drops a spreadsheet's responses after a write", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "before"});
+	mock->AddResponse({200, {}, "{}"});
+	mock->AddResponse({200, {}, "after"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::seconds(60)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "before");
+	client.Execute(Request(HttpMethod::PUT, VALUES_URL));
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "after");
+}
+
+TEST_CASE("CachingHttpClient validates cached responses against the Drive version", "[cache]") {
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	auto options = Options(std::chrono::seconds(60), true);
+
+	auto first_mock = new MockHttpClient();
+	first_mock->AddResponse({200, {}, R"({"version": "7"})"});
+	first_mock->AddResponse({200, {}, "v7"});
+	CachingHttpClient first(std::unique_ptr<MockHttpClient>(first_mock), cache, metrics, options);
+	REQUIRE(first.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "v7");
+	REQUIRE(first_mock->GetRecordedRequests()[0].url ==
+	        "https://www.googleapis.com/drive/v3/files/abc123?fields=version&supportsAllDrives=true");
+
+	auto second_mock = new MockHttpClient();
+	second_mock->AddResponse({200, {}, R"({"version": "7"})"});
+	CachingHttpClient second(std::unique_ptr<MockHttpClient>(second_mock), cache, metrics, options);
+	REQUIRE(second.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "v7");
+
+	auto third_mock = new MockHttpClient();
+	third_mock->AddResponse({200, {}, R"({"version": "8"})"});
+	third_mock->AddResponse({200, {}, "v8"});
+	CachingHttpClient third(std::unique_ptr<MockHttpClient>(third_mock), cache, metrics, options);
+	REQUIRE(third.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "v8");
+	// The version read to check the cached response is stored with the new one
+	REQUIRE(third_mock->GetRecordedRequests().size() == 2);
+
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_HITS_METRIC) == 1);
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_VALIDATIONS_METRIC) == 3);
+}
+
+TEST_CASE("CachingHttpClient reads the version once per spreadsheet", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, R"({"version": "7"})"});
+	mock->AddResponse({200, {}, "rows 1-10"});
+	mock->AddResponse({200, {}, "rows 11-20"});
+	mock->AddResponse({200, {}, "{}"});
+	mock->AddResponse({200, {}, R"({"version": "8"})"});
+	mock->AddResponse({200, {}, "rows 1-10 after write"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::seconds(60), true));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "rows 1-10");
+	REQUIRE(client.Execute(Request(HttpMethod::GET, std::string(VALUES_URL) + "0")).body == "rows 11-20");
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "rows 1-10");
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_VALIDATIONS_METRIC) == 1);
+
+	// A write changes the version
+	client.Execute(Request(HttpMethod::PUT, VALUES_URL));
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "rows 1-10 after write");
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_VALIDATIONS_METRIC) == 2);
+	REQUIRE(mock->GetRecordedRequests().size() == 6);
+}
+
+TEST_CASE("CachingHttpClient doesn't cache when the version can't be read", "[cache]") {
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	auto options = Options(std::chrono::seconds(60), true);
+
+	auto first_mock = new MockHttpClient();
+	first_mock->AddResponse({403, {}, "insufficient scopes"});
+	first_mock->AddResponse({200, {}, "first"});
+	first_mock->AddResponse({200, {}, "second"});
+	CachingHttpClient first(std::unique_ptr<MockHttpClient>(first_mock), cache, metrics, options);
+	REQUIRE(first.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "first");
+	REQUIRE(first.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "second");
+	REQUIRE(cache->EntryCount() == 0);
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_VALIDATION_ERRORS_METRIC) == 1);
+
+	// The missing scope is remembered by the shared cache
+	auto second_mock = new MockHttpClient();
+	second_mock->AddResponse({200, {}, "third"});
+	CachingHttpClient second(std::unique_ptr<MockHttpClient>(second_mock), cache, metrics, options);
+	REQUIRE(second.Execute(Request(HttpMethod::GET, VALUES_URL)).body == "third");
+	REQUIRE(second_mock->GetRecordedRequests().size() == 1);
+	REQUIRE(metrics->Get(duckdb::sheets::CACHE_VALIDATIONS_METRIC) == 1);
+}
+
+// =============================================================================
+// ResponseCache Tests
+// =============================================================================
+
+TEST_CASE("ResponseCache evicts the least recently used entries over budget", "[cache]") {
+	ResponseCache cache(30);
+	ResponseCache::Entry entry;
+	entry.response.body = "0123456789";
+
+	REQUIRE(cache.Put("a", entry) == 0);
+	REQUIRE(cache.Put("b", entry) == 0);
+	// Reading a makes b the least recently used
+	REQUIRE(cache.Get("a", entry));
+	REQUIRE(cache.Put("c", entry) == 1);
+
+	REQUIRE(cache.EntryCount() == 2);
+	REQUIRE(cache.ByteCount() == 22);
+	REQUIRE_FALSE(cache.Get("b", entry));
+	REQUIRE(cache.Get("a", entry));
+	REQUIRE(cache.Get("c", entry));
+}
+
+TEST_CASE("ResponseCache skips entries larger than the budget", "[cache]") {
+	ResponseCache cache(5);
+	ResponseCache::Entry entry;
+	entry.response.body = "0123456789";
+
+	REQUIRE(cache.Put("a", entry) == 0);
+	REQUIRE(cache.EntryCount() == 0);
+	REQUIRE(cache.ByteCount() == 0);
+}
+
+// =============================================================================
+// Spreadsheet metadata Tests
+// =============================================================================
+
+static const char *METADATA_URL = "https://sheets.googleapis.com/v4/spreadsheets/abc123?fields=sheets.properties";
+
+TEST_CASE("IsMetadataRead only accepts spreadsheets.get", "[cache]") {
+	using duckdb::sheets::IsMetadataRead;
+	REQUIRE(IsMetadataRead(Request(HttpMethod::GET, METADATA_URL)));
+	REQUIRE(IsMetadataRead(Request(HttpMethod::GET, "https://sheets.googleapis.com/v4/spreadsheets/abc123")));
+	REQUIRE_FALSE(IsMetadataRead(Request(HttpMethod::GET, VALUES_URL)));
+	REQUIRE_FALSE(IsMetadataRead(Request(HttpMethod::GET, "https://docs.google.com/spreadsheets/d/abc123/gviz/tq")));
+	REQUIRE_FALSE(
+	    IsMetadataRead(Request(HttpMethod::POST, "https://sheets.googleapis.com/v4/spreadsheets/abc123:batchUpdate")));
+}
+
+TEST_CASE("CachingHttpClient fetches metadata once per client", "[cache]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "sheets"});
+	mock->AddResponse({200, {}, "{}"});
+	mock->AddResponse({200, {}, "sheets after write"});
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics,
+	                         Options(std::chrono::milliseconds(0)));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, METADATA_URL)).body == "sheets");
+	REQUIRE(client.Execute(Request(HttpMethod::GET, METADATA_URL)).body == "sheets");
+	REQUIRE(metrics->Get(duckdb::sheets::METADATA_CACHE_HITS_METRIC) == 1);
+	// Without a metadata ttl nothing is shared with other clients
+	REQUIRE(cache->EntryCount() == 0);
+
+	client.Execute(Request(HttpMethod::POST, "https://sheets.googleapis.com/v4/spreadsheets/abc123:batchUpdate"));
+	REQUIRE(client.Execute(Request(HttpMethod::GET, METADATA_URL)).body == "sheets after write");
+}
+
+TEST_CASE("CachingHttpClient shares metadata between clients for the metadata ttl", "[cache]") {
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	auto options = Options(std::chrono::milliseconds(0));
+	options.metadataTtl = std::chrono::seconds(60);
+
+	auto first_mock = new MockHttpClient();
+	first_mock->AddResponse({200, {}, "sheets"});
+	CachingHttpClient first(std::unique_ptr<MockHttpClient>(first_mock), cache, metrics, options);
+	REQUIRE(first.Execute(Request(HttpMethod::GET, METADATA_URL)).body == "sheets");
+
+	auto second_mock = new MockHttpClient();
+	CachingHttpClient second(std::unique_ptr<MockHttpClient>(second_mock), cache, metrics, options);
+	REQUIRE(second.Execute(Request(HttpMethod::GET, METADATA_URL)).body == "sheets");
+	REQUIRE(second_mock->GetRecordedRequests().empty());
+}
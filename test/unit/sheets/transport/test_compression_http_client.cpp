@@ -0,0 +1,97 @@
+#include "catch.hpp"
+
+#include "sheets/transport/compression_http_client.hpp"
+#include "sheets/transport/mock_http_client.hpp"
+#include "sheets/util/gzip.hpp"
+
+using duckdb::sheets::CompressionHttpClient;
+using duckdb::sheets::CompressionOptions;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::MockHttpClient;
+
+static HttpRequest Request(HttpMethod method, const std::string &body = "") {
+	HttpRequest request;
+	request.method = method;
+	request.url = "https://sheets.googleapis.com/v4/spreadsheets/abc123/values/Sheet1";
+	request.headers["User-Agent"] = "duckdb-gsheets/dev";
+	request.body = body;
+	return request;
+}
+
+TEST_CASE("CompressionHttpClient asks for gzip responses", "[compression]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "{}"});
+	Metrics metrics;
+	CompressionHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, CompressionOptions());
+
+	client.Execute(Request(HttpMethod::GET));
+
+	auto &sent = mock->GetRecordedRequests()[0];
+	REQUIRE(sent.headers.at("Accept-Encoding") == "gzip");
+	REQUIRE(sent.headers.at("User-Agent") == "duckdb-gsheets/dev (gzip)");
+}
+
+TEST_CASE("CompressionHttpClient decodes gzip responses and counts the bytes", "[compression]") {
+	std::string body(10000, 'x');
+	auto compressed = duckdb::sheets::GzipCompress(body);
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {{"content-encoding", "gzip"}}, compressed});
+	Metrics metrics;
+	CompressionHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, CompressionOptions());
+
+	auto response = client.Execute(Request(HttpMethod::GET));
+
+	REQUIRE(response.body == body);
+	REQUIRE(response.headers.count("content-encoding") == 0);
+	REQUIRE(metrics.Get(duckdb::sheets::RESPONSE_BYTES_METRIC) == static_cast<int64_t>(compressed.size()));
+	REQUIRE(metrics.Get(duckdb::sheets::RESPONSE_BYTES_DECOMPRESSED_METRIC) == 10000);
+}
+
+TEST_CASE("CompressionHttpClient passes through bodies the transport already decoded", "[compression]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {{"Content-Encoding", "gzip"}}, R"({"values": []})"});
+	Metrics metrics;
+	CompressionHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, CompressionOptions());
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET)).body == R"({"values": []})");
+}
+
+TEST_CASE("CompressionHttpClient leaves responses alone when disabled", "[compression]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "{}"});
+	Metrics metrics;
+	CompressionOptions options;
+	options.acceptGzip = false;
+	CompressionHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, options);
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "{}");
+	auto &sent = mock->GetRecordedRequests()[0];
+	REQUIRE(sent.headers.count("Accept-Encoding") == 0);
+	REQUIRE(sent.headers.at("User-Agent") == "duckdb-gsheets/dev");
+}
+
+TEST_CASE("CompressionHttpClient compresses large request bodies when enabled", "[compression]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, "{}"});
+	mock->AddResponse({200, {}, "{}"});
+	Metrics metrics;
+	CompressionOptions options;
+	options.compressRequests = true;
+	CompressionHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, options);
+
+	std::string large(5000, 'a');
+	client.Execute(Request(HttpMethod::PUT, large));
+	client.Execute(Request(HttpMethod::POST, "{}"));
+
+	auto &requests = mock->GetRecordedRequests();
+	REQUIRE(requests[0].headers.at("Content-Encoding") == "gzip");
+	REQUIRE(duckdb::sheets::GzipDecompress(requests[0].body) == large);
+	// Small bodies aren't worth compressing
+	REQUIRE(requests[1].headers.count("Content-Encoding") == 0);
+	REQUIRE(requests[1].body == "{}");
+	REQUIRE(metrics.Get(duckdb::sheets::REQUEST_BYTES_UNCOMPRESSED_METRIC) == 5002);
+	REQUIRE(metrics.Get(duckdb::sheets::REQUEST_BYTES_METRIC) ==
+	        static_cast<int64_t>(requests[0].body.size()) + 2);
+}
@@ -0,0 +1,168 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CPPHTTPLIB_OPENSSL_SUPPORT
+#include "httplib.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "sheets/transport/curl_http_client.hpp"
+
+using duckdb::sheets::CurlHttpClient;
+using duckdb::sheets::CurlOptions;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpProxyConfig;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::HttpResponse;
+using duckdb::sheets::HttpTimeouts;
+
+namespace httplib = duckdb_httplib_openssl;
+
+// Plain HTTP server on a free local port, answering until it goes out of scope
+class TestServer {
+public:
+	TestServer() {
+		server.Get("/values", [](const httplib::Request &, httplib::Response &res) {
+			res.set_header("X-Test", "yes");
+			res.set_content(R"({"values": [["a", "b"]]})", "application/json");
+		});
+		auto echo = [](const httplib::Request &req, httplib::Response &res) {
+			res.set_header("X-Method", req.method);
+			res.set_header("X-Content-Type", req.get_header_value("Content-Type"));
+			res.set_content(req.body, "application/json");
+		};
+		server.Post("/echo", echo);
+		server.Put("/echo", echo);
+		server.Get("/missing", [](const httplib::Request &, httplib::Response &res) {
+			res.status = 404;
+			res.set_content("not found", "text/plain");
+		});
+		server.Get("/slow", [](const httplib::Request &, httplib::Response &res) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+			res.set_content("late", "text/plain");
+		});
+		port = server.bind_to_any_port("127.0.0.1");
+		listener = std::thread([this]() { server.listen_after_bind(); });
+		server.wait_until_ready();
+	}
+
+	~TestServer() {
+		server.stop();
+		listener.join();
+	}
+
+	std::string Url(const std::string &path) const {
+		return "http://127.0.0.1:" + std::to_string(port) + path;
+	}
+
+private:
+	httplib::Server server;
+	std::thread listener;
+	int port;
+};
+
+static HttpRequest Request(HttpMethod method, const std::string &url, const std::string &body = "") {
+	HttpRequest request;
+	request.method = method;
+	request.url = url;
+	request.body = body;
+	return request;
+}
+
+// The local server only speaks HTTP/1.1, over plain HTTP curl wouldn't try HTTP/2 anyway
+static CurlOptions Options() {
+	CurlOptions options;
+	options.http2 = false;
+	return options;
+}
+
+TEST_CASE("CurlHttpClient sends GETs and returns the response", "[curl]") {
+	TestServer server;
+	CurlHttpClient client(HttpProxyConfig(), Options());
+
+	auto response = client.Execute(Request(HttpMethod::GET, server.Url("/values")));
+	REQUIRE(response.statusCode == 200);
+	REQUIRE(response.body == R"({"values": [["a", "b"]]})");
+	REQUIRE(response.headers["X-Test"] == "yes");
+}
+
+TEST_CASE("CurlHttpClient round trips request bodies", "[curl]") {
+	TestServer server;
+	CurlHttpClient client(HttpProxyConfig(), Options());
+	std::string body = R"({"values": [[")" + std::string(100000, 'x') + R"("]]})";
+
+	auto post = client.Execute(Request(HttpMethod::POST, server.Url("/echo"), body));
+	REQUIRE(post.statusCode == 200);
+	REQUIRE(post.body == body);
+	REQUIRE(post.headers["X-Method"] == "POST");
+	// Bodies are JSON unless the request says otherwise
+	REQUIRE(post.headers["X-Content-Type"] == "application/json");
+
+	auto put_request = Request(HttpMethod::PUT, server.Url("/echo"), "a,b");
+	put_request.headers["Content-Type"] = "text/csv";
+	auto put = client.Execute(put_request);
+	REQUIRE(put.body == "a,b");
+	REQUIRE(put.headers["X-Method"] == "PUT");
+	REQUIRE(put.headers["X-Content-Type"] == "text/csv");
+}
+
+TEST_CASE("CurlHttpClient returns non-2xx responses", "[curl]") {
+	TestServer server;
+	CurlHttpClient client(HttpProxyConfig(), Options());
+
+	auto response = client.Execute(Request(HttpMethod::GET, server.Url("/missing")));
+	REQUIRE(response.statusCode == 404);
+	REQUIRE(response.body == "not found");
+}
+
+TEST_CASE("CurlHttpClient fails requests past the total timeout", "[curl]") {
+	TestServer server;
+	HttpTimeouts timeouts;
+	timeouts.total = std::chrono::milliseconds(200);
+	CurlHttpClient client(HttpProxyConfig(), Options(), nullptr, timeouts);
+
+	auto start = std::chrono::steady_clock::now();
+	REQUIRE_THROWS_AS(client.Execute(Request(HttpMethod::GET, server.Url("/slow"))), duckdb::IOException);
+	REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(900));
+}
+
+TEST_CASE("CurlHttpClient aborts cancelled requests", "[curl]") {
+	TestServer server;
+	CurlHttpClient client(HttpProxyConfig(), Options());
+
+	auto request = Request(HttpMethod::GET, server.Url("/slow"));
+	request.cancelled = std::make_shared<std::atomic<bool>>(false);
+	auto pending = client.ExecuteAsync(request);
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	*request.cancelled = true;
+	REQUIRE_THROWS_AS(pending.get(), duckdb::IOException);
+}
+
+TEST_CASE("CurlHttpClient runs concurrent requests on its loop", "[curl]") {
+	TestServer server;
+	CurlHttpClient client(HttpProxyConfig(), Options());
+
+	std::vector<std::future<HttpResponse>> pending;
+	for (int i = 0; i < 20; i++) {
+		pending.push_back(client.ExecuteAsync(Request(HttpMethod::POST, server.Url("/echo"), std::to_string(i))));
+	}
+	for (int i = 0; i < 20; i++) {
+		REQUIRE(pending[i].get().body == std::to_string(i));
+	}
+}
+
+TEST_CASE("CurlHttpClient fails requests to a closed port", "[curl]") {
+	std::string url;
+	{
+		TestServer server;
+		url = server.Url("/values");
+	}
+	CurlHttpClient client(HttpProxyConfig(), Options());
+	REQUIRE_THROWS_AS(client.Execute(Request(HttpMethod::GET, url)), duckdb::IOException);
+}
@@ -0,0 +1,148 @@
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "catch.hpp"
+
+#include "sheets/transport/caching_http_client.hpp"
+#include "sheets/transport/disk_response_store.hpp"
+#include "sheets/transport/mock_http_client.hpp"
+
+using duckdb::sheets::CacheOptions;
+using duckdb::sheets::CachingHttpClient;
+using duckdb::sheets::DiskResponseStore;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::MockHttpClient;
+using duckdb::sheets::ResponseCache;
+
+static std::string TempDirectory() {
+	char path[] = "/tmp/gsheets_cache_XXXXXX";
+	REQUIRE(mkdtemp(path) != nullptr);
+	return path;
+}
+
+static ResponseCache::Entry Entry(const std::string &spreadsheetId, const std::string &version,
+                                  const std::string &body) {
+	ResponseCache::Entry entry;
+	entry.response.statusCode = 200;
+	entry.response.body = body;
+	entry.spreadsheetId = spreadsheetId;
+	entry.version = version;
+	return entry;
+}
+
+// =============================================================================
+// DiskResponseStore Tests
+// =============================================================================
+
+TEST_CASE("DiskResponseStore keeps responses across instances", "[disk_cache]") {
+	auto directory = TempDirectory();
+	{
+		DiskResponseStore store(directory);
+		store.Store("key", Entry("abc123", "7", "{\"values\": [[\"a\"]]}\n"));
+	}
+
+	DiskResponseStore store(directory);
+	ResponseCache::Entry entry;
+	REQUIRE(store.Load("key", "abc123", entry));
+	REQUIRE(entry.response.statusCode == 200);
+	REQUIRE(entry.response.body == "{\"values\": [[\"a\"]]}\n");
+	REQUIRE(entry.version == "7");
+	REQUIRE(entry.spreadsheetId == "abc123");
+	REQUIRE(store.FileCount() == 1);
+	REQUIRE_FALSE(store.Load("other", "abc123", entry));
+}
+
+TEST_CASE("DiskResponseStore evicts the least recently used files over budget", "[disk_cache]") {
+	auto directory = TempDirectory();
+	DiskResponseStore store(directory);
+	store.Store("a", Entry("abc123", "1", std::string(100, 'a')));
+	size_t file_size = store.ByteCount();
+	store.Store("b", Entry("abc123", "1", std::string(100, 'b')));
+	ResponseCache::Entry entry;
+	REQUIRE(store.Load("a", "abc123", entry));
+
+	REQUIRE(store.SetMaxBytes(file_size + 10) == 1);
+	REQUIRE(store.Load("a", "abc123", entry));
+	REQUIRE_FALSE(store.Load("b", "abc123", entry));
+
+	// The eviction is persisted in the index
+	DiskResponseStore reopened(directory);
+	REQUIRE(reopened.FileCount() == 1);
+}
+
+TEST_CASE("DiskResponseStore keeps the last use of loaded files across instances", "[disk_cache]") {
+	auto directory = TempDirectory();
+	size_t file_size;
+	{
+		DiskResponseStore store(directory);
+		store.Store("a", Entry("abc123", "1", std::string(100, 'a')));
+		file_size = store.ByteCount();
+		store.Store("b", Entry("abc123", "1", std::string(100, 'b')));
+		ResponseCache::Entry entry;
+		REQUIRE(store.Load("a", "abc123", entry));
+	}
+
+	DiskResponseStore store(directory);
+	REQUIRE(store.SetMaxBytes(file_size + 10) == 1);
+	ResponseCache::Entry entry;
+	REQUIRE(store.Load("a", "abc123", entry));
+	REQUIRE_FALSE(store.Load("b", "abc123", entry));
+}
+
+TEST_CASE("DiskResponseStore removes the files of a spreadsheet", "[disk_cache]") {
+	auto directory = TempDirectory();
+	DiskResponseStore store(directory);
+	store.Store("a", Entry("abc123", "1", "a"));
+	store.Store("b", Entry("def456", "1", "b"));
+
+	store.RemoveSpreadsheet("abc123");
+
+	ResponseCache::Entry entry;
+	REQUIRE_FALSE(store.Load("a", "abc123", entry));
+	REQUIRE(store.Load("b", "def456", entry));
+	REQUIRE(store.Clear() == 1);
+	REQUIRE(store.ByteCount() == 0);
+}
+
+// =============================================================================
+// CachingHttpClient with a DiskResponseStore Tests
+// =============================================================================
+
+TEST_CASE("CachingHttpClient serves responses on disk when the version is unchanged", "[disk_cache]") {
+	auto directory = TempDirectory();
+	auto store = std::make_shared<DiskResponseStore>(directory);
+	HttpRequest request;
+	request.method = HttpMethod::GET;
+	request.url = "https://sheets.googleapis.com/v4/spreadsheets/abc123/values/Sheet1";
+
+	{
+		auto mock = new MockHttpClient();
+		mock->AddResponse({200, {}, R"({"version": "7"})"});
+		mock->AddResponse({200, {}, "v7"});
+		auto cache = std::make_shared<ResponseCache>();
+		auto metrics = std::make_shared<Metrics>();
+		CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics, CacheOptions(), store);
+		REQUIRE(client.Execute(request).body == "v7");
+	}
+
+	// A new process: nothing in memory, the version is checked before using the file
+	auto cache = std::make_shared<ResponseCache>();
+	auto metrics = std::make_shared<Metrics>();
+	{
+		auto mock = new MockHttpClient();
+		mock->AddResponse({200, {}, R"({"version": "7"})"});
+		CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics, CacheOptions(), store);
+		REQUIRE(client.Execute(request).body == "v7");
+		REQUIRE(metrics->Get(duckdb::sheets::DISK_CACHE_HITS_METRIC) == 1);
+	}
+
+	auto mock = new MockHttpClient();
+	mock->AddResponse({200, {}, R"({"version": "8"})"});
+	mock->AddResponse({200, {}, "v8"});
+	CachingHttpClient client(std::unique_ptr<MockHttpClient>(mock), cache, metrics, CacheOptions(), store);
+	REQUIRE(client.Execute(request).body == "v8");
+	REQUIRE(mock->GetRecordedRequests().size() == 2);
+}
@@ -0,0 +1,199 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "sheets/transport/hedging_http_client.hpp"
+
+using duckdb::sheets::HedgingHttpClient;
+using duckdb::sheets::HedgingOptions;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::HttpResponse;
+using duckdb::sheets::IHttpClient;
+using duckdb::sheets::LatencyTracker;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::RequestScheduler;
+using duckdb::sheets::SchedulerOptions;
+
+static HttpRequest Request(HttpMethod method) {
+	HttpRequest request;
+	request.method = method;
+	request.url = "https://sheets.googleapis.com/v4/spreadsheets/abc123/values/Sheet1";
+	return request;
+}
+
+// Answers the first request after stallMs (or once it is cancelled) and later ones right away
+class StallingHttpClient : public IHttpClient {
+public:
+	explicit StallingHttpClient(int stallMs, bool fail = false) : stallMs(stallMs), fail(fail) {
+	}
+
+	HttpResponse Execute(const HttpRequest &request) override {
+		int call = ++calls;
+		if (call == 1) {
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(stallMs);
+			while (std::chrono::steady_clock::now() < deadline) {
+				if (request.cancelled && *request.cancelled) {
+					cancelled = true;
+					break;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+		if (fail) {
+			throw std::runtime_error("connection reset");
+		}
+		return HttpResponse {200, {}, call == 1 ? "first" : "second"};
+	}
+
+	int stallMs;
+	bool fail;
+	std::atomic<int> calls {0};
+	std::atomic<bool> cancelled {false};
+};
+
+static void Warm(LatencyTracker &latencies, int ms) {
+	for (int i = 0; i < 20; i++) {
+		latencies.Record(std::chrono::milliseconds(ms));
+	}
+}
+
+static HedgingOptions Options() {
+	HedgingOptions options;
+	options.minDelay = std::chrono::milliseconds(10);
+	return options;
+}
+
+TEST_CASE("LatencyTracker reports percentiles of the recent latencies", "[hedging]") {
+	LatencyTracker latencies(100);
+	REQUIRE(latencies.Percentile(0.95).count() == 0);
+	for (int i = 1; i <= 200; i++) {
+		latencies.Record(std::chrono::milliseconds(i));
+	}
+	// Only the last 100 are kept
+	REQUIRE(latencies.Count() == 100);
+	REQUIRE(latencies.Percentile(0.0).count() == 101);
+	REQUIRE(latencies.Percentile(0.95).count() == 195);
+	REQUIRE(latencies.Percentile(1.0).count() == 200);
+}
+
+TEST_CASE("HedgingHttpClient doesn't hedge before enough latencies are recorded", "[hedging]") {
+	auto inner = new StallingHttpClient(50);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Metrics metrics;
+	HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "first");
+	REQUIRE(inner->calls == 1);
+	REQUIRE(latencies->Count() == 1);
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 0);
+}
+
+TEST_CASE("HedgingHttpClient answers a stalled GET with its hedge and cancels the original", "[hedging]") {
+	auto inner = new StallingHttpClient(5000);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 20);
+	Metrics metrics;
+	auto start = std::chrono::steady_clock::now();
+	{
+		HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+		REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "second");
+	}
+	// The client waited for the cancelled original rather than its whole stall
+	REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(2));
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 1);
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGE_WINS_METRIC) == 1);
+}
+
+TEST_CASE("HedgingHttpClient records the latency of the copy that answered", "[hedging]") {
+	auto inner = new StallingHttpClient(5000);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 20);
+	Metrics metrics;
+	{
+		HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+		REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "second");
+	}
+	// The hedge's latency, not the stalled original's
+	REQUIRE(latencies->Count() == 21);
+	REQUIRE(latencies->Percentile(1.0) < std::chrono::milliseconds(1000));
+}
+
+TEST_CASE("HedgingHttpClient caps the hedges in flight", "[hedging]") {
+	auto inner = new StallingHttpClient(200);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 20);
+	Metrics metrics;
+	// Another request's hedge uses the one allowed
+	REQUIRE(latencies->TryBeginHedge(0.1));
+	{
+		HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+		REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "first");
+	}
+	latencies->EndHedge();
+	REQUIRE(inner->calls == 1);
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 0);
+	REQUIRE(latencies->TryBeginHedge(0.1));
+}
+
+TEST_CASE("HedgingHttpClient only hedges when the scheduler admits the hedge right away", "[hedging]") {
+	auto inner = new StallingHttpClient(200);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 20);
+	Metrics metrics;
+	SchedulerOptions scheduler_options;
+	scheduler_options.readsPerMinute = 0;
+	scheduler_options.maxInFlight = 1;
+	auto scheduler = std::make_shared<RequestScheduler>(scheduler_options);
+	// The original request holds the only slot, as the SchedulingHttpClient above would
+	scheduler->Acquire(duckdb::sheets::RequestClass::READ);
+	{
+		HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options(), scheduler);
+		REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "first");
+	}
+	REQUIRE(inner->calls == 1);
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 0);
+	// The skipped hedge gave its place back
+	REQUIRE(latencies->TryBeginHedge(0.1));
+	latencies->EndHedge();
+
+	// With a free slot the hedge is admitted, and releases its slot once done
+	scheduler_options.maxInFlight = 2;
+	scheduler->Configure(scheduler_options);
+	auto stalled = new StallingHttpClient(5000);
+	{
+		HedgingHttpClient client(std::unique_ptr<IHttpClient>(stalled), latencies, metrics, Options(), scheduler);
+		REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "second");
+	}
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 1);
+	scheduler->Release();
+	REQUIRE(scheduler->InFlight() == 0);
+}
+
+TEST_CASE("HedgingHttpClient sends fast GETs and other requests once", "[hedging]") {
+	auto inner = new StallingHttpClient(0);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 200);
+	Metrics metrics;
+	HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET)).body == "first");
+	REQUIRE(client.Execute(Request(HttpMethod::POST)).body == "second");
+	REQUIRE(inner->calls == 2);
+	REQUIRE(metrics.Get(duckdb::sheets::HEDGED_REQUESTS_METRIC) == 0);
+}
+
+TEST_CASE("HedgingHttpClient fails when every copy fails", "[hedging]") {
+	auto inner = new StallingHttpClient(100, true);
+	auto latencies = std::make_shared<LatencyTracker>();
+	Warm(*latencies, 20);
+	Metrics metrics;
+	HedgingHttpClient client(std::unique_ptr<IHttpClient>(inner), latencies, metrics, Options());
+
+	REQUIRE_THROWS_AS(client.Execute(Request(HttpMethod::GET)), std::runtime_error);
+	REQUIRE(inner->calls == 2);
+}
@@ -0,0 +1,69 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "sheets/transport/http_executor.hpp"
+
+using duckdb::sheets::HttpExecutor;
+using duckdb::sheets::HttpResponse;
+
+TEST_CASE("HttpExecutor returns the response through the future", "[http_executor]") {
+	HttpExecutor executor(2);
+
+	auto future = executor.Submit([]() { return HttpResponse {200, {}, "body"}; });
+
+	auto response = future.get();
+	REQUIRE(response.statusCode == 200);
+	REQUIRE(response.body == "body");
+}
+
+TEST_CASE("HttpExecutor rethrows exceptions of the request", "[http_executor]") {
+	HttpExecutor executor(2);
+
+	auto future = executor.Submit([]() -> HttpResponse { throw std::runtime_error("connection refused"); });
+
+	REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+}
+
+TEST_CASE("HttpExecutor keeps several requests in flight", "[http_executor]") {
+	HttpExecutor executor(4);
+	std::atomic<int> running {0};
+	std::atomic<int> max_running {0};
+
+	std::vector<std::future<HttpResponse>> futures;
+	for (int i = 0; i < 4; i++) {
+		futures.push_back(executor.Submit([&]() {
+			int now = ++running;
+			int seen = max_running;
+			while (now > seen && !max_running.compare_exchange_weak(seen, now)) {
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			running--;
+			return HttpResponse {200, {}, ""};
+		}));
+	}
+	for (auto &future : futures) {
+		REQUIRE(future.get().statusCode == 200);
+	}
+	REQUIRE(max_running > 1);
+	REQUIRE(max_running <= 4);
+}
+
+TEST_CASE("HttpExecutor runs queued requests before it is destroyed", "[http_executor]") {
+	std::atomic<int> completed {0};
+	std::vector<std::future<HttpResponse>> futures;
+	{
+		HttpExecutor executor(1);
+		for (int i = 0; i < 3; i++) {
+			futures.push_back(executor.Submit([&]() {
+				completed++;
+				return HttpResponse {200, {}, ""};
+			}));
+		}
+	}
+	REQUIRE(completed == 3);
+}
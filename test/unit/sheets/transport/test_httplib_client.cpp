@@ -0,0 +1,111 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+#define CPPHTTPLIB_OPENSSL_SUPPORT
+#include "httplib.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "sheets/transport/httplib_client.hpp"
+
+using duckdb::sheets::ConnectionPoolOptions;
+using duckdb::sheets::HttpLibClient;
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpProxyConfig;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::HttpTimeouts;
+
+namespace httplib = duckdb_httplib_openssl;
+
+// Plain HTTP server on a free local port, answering until it goes out of scope
+class HttpLibTestServer {
+public:
+	HttpLibTestServer() {
+		server.Get("/values", [](const httplib::Request &, httplib::Response &res) {
+			res.set_content(R"({"values": [["a", "b"]]})", "application/json");
+		});
+		auto slow = [](const httplib::Request &req, httplib::Response &res) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+			res.set_content(req.body, "application/json");
+		};
+		server.Get("/slow", slow);
+		server.Post("/slow", slow);
+		server.Put("/slow", slow);
+		server.Delete("/slow", slow);
+		port = server.bind_to_any_port("127.0.0.1");
+		listener = std::thread([this]() { server.listen_after_bind(); });
+		server.wait_until_ready();
+	}
+
+	~HttpLibTestServer() {
+		server.stop();
+		listener.join();
+	}
+
+	std::string Url(const std::string &path) const {
+		return "http://127.0.0.1:" + std::to_string(port) + path;
+	}
+
+private:
+	httplib::Server server;
+	std::thread listener;
+	int port;
+};
+
+static HttpRequest Request(HttpMethod method, const std::string &url, const std::string &body = "") {
+	HttpRequest request;
+	request.method = method;
+	request.url = url;
+	request.body = body;
+	return request;
+}
+
+static HttpTimeouts TotalTimeout(std::chrono::milliseconds total) {
+	HttpTimeouts timeouts;
+	timeouts.total = total;
+	return timeouts;
+}
+
+TEST_CASE("HttpLibClient fails requests of every method past the total timeout", "[httplib]") {
+	HttpLibTestServer server;
+	HttpLibClient client(HttpProxyConfig(), ConnectionPoolOptions(), nullptr,
+	                     TotalTimeout(std::chrono::milliseconds(200)));
+
+	for (auto method : {HttpMethod::GET, HttpMethod::POST, HttpMethod::PUT, HttpMethod::DEL}) {
+		auto start = std::chrono::steady_clock::now();
+		REQUIRE_THROWS_WITH(client.Execute(Request(method, server.Url("/slow"), "{}")),
+		                    Catch::Contains("timed out after 200 ms"));
+		REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(900));
+	}
+}
+
+TEST_CASE("HttpLibClient keeps answering after a request timed out", "[httplib]") {
+	HttpLibTestServer server;
+	HttpLibClient client(HttpProxyConfig(), ConnectionPoolOptions(), nullptr,
+	                     TotalTimeout(std::chrono::milliseconds(200)));
+
+	REQUIRE_THROWS_AS(client.Execute(Request(HttpMethod::POST, server.Url("/slow"), "{}")), duckdb::IOException);
+	// The stopped connection is dropped rather than reused
+	auto response = client.Execute(Request(HttpMethod::GET, server.Url("/values")));
+	REQUIRE(response.statusCode == 200);
+	REQUIRE(response.body == R"({"values": [["a", "b"]]})");
+}
+
+TEST_CASE("HttpLibClient aborts cancelled writes", "[httplib]") {
+	HttpLibTestServer server;
+	HttpLibClient client {HttpProxyConfig()};
+
+	auto request = Request(HttpMethod::PUT, server.Url("/slow"), "{}");
+	request.cancelled = std::make_shared<std::atomic<bool>>(false);
+	auto start = std::chrono::steady_clock::now();
+	auto pending = std::async(std::launch::async, [&]() { return client.Execute(request); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	*request.cancelled = true;
+	REQUIRE_THROWS_WITH(pending.get(), Catch::Contains("cancelled"));
+	REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(900));
+}
@@ -0,0 +1,167 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sheets/transport/mock_http_client.hpp"
+#include "sheets/transport/request_scheduler.hpp"
+
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::MockHttpClient;
+using duckdb::sheets::RequestClass;
+using duckdb::sheets::RequestScheduler;
+using duckdb::sheets::SchedulerOptions;
+using duckdb::sheets::SchedulingHttpClient;
+
+static HttpRequest Request(HttpMethod method, const std::string &url) {
+	HttpRequest request;
+	request.method = method;
+	request.url = url;
+	return request;
+}
+
+static SchedulerOptions Unlimited() {
+	SchedulerOptions options;
+	options.readsPerMinute = 0;
+	options.writesPerMinute = 0;
+	options.maxInFlight = 0;
+	return options;
+}
+
+TEST_CASE("ClassifyRequest separates Sheets reads, Sheets writes and other APIs", "[scheduler]") {
+	using duckdb::sheets::ClassifyRequest;
+	std::string values = "https://sheets.googleapis.com/v4/spreadsheets/abc/values/Sheet1";
+	REQUIRE(ClassifyRequest(Request(HttpMethod::GET, values)) == RequestClass::READ);
+	REQUIRE(ClassifyRequest(Request(HttpMethod::POST, values + ":append")) == RequestClass::WRITE);
+	REQUIRE(ClassifyRequest(Request(HttpMethod::PUT, values)) == RequestClass::WRITE);
+	REQUIRE(ClassifyRequest(Request(HttpMethod::POST, "https://oauth2.googleapis.com/token")) ==
+	        RequestClass::UNMETERED);
+	REQUIRE(ClassifyRequest(Request(HttpMethod::GET, "https://www.googleapis.com/drive/v3/files/abc")) ==
+	        RequestClass::UNMETERED);
+}
+
+TEST_CASE("RequestScheduler spends a burst at once and then waits for the rate", "[scheduler]") {
+	auto options = Unlimited();
+	// 2 requests per second, a burst of 2
+	options.readsPerMinute = 120;
+	options.writesPerMinute = 120;
+	options.burstSeconds = 1;
+	RequestScheduler scheduler(options);
+
+	auto start = std::chrono::steady_clock::now();
+	scheduler.Acquire(RequestClass::READ);
+	scheduler.Release();
+	scheduler.Acquire(RequestClass::READ);
+	scheduler.Release();
+	auto burst = std::chrono::steady_clock::now() - start;
+	scheduler.Acquire(RequestClass::READ);
+	scheduler.Release();
+	auto third = std::chrono::steady_clock::now() - start;
+
+	REQUIRE(burst < std::chrono::milliseconds(50));
+	REQUIRE(third >= std::chrono::milliseconds(400));
+	// Writes have a quota of their own
+	auto write_start = std::chrono::steady_clock::now();
+	scheduler.Acquire(RequestClass::WRITE);
+	scheduler.Release();
+	REQUIRE(std::chrono::steady_clock::now() - write_start < std::chrono::milliseconds(50));
+}
+
+TEST_CASE("RequestScheduler limits the requests in flight", "[scheduler]") {
+	auto options = Unlimited();
+	options.maxInFlight = 2;
+	auto scheduler = std::make_shared<RequestScheduler>(options);
+	std::atomic<int> running {0};
+	std::atomic<int> max_running {0};
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 6; i++) {
+		threads.emplace_back([&]() {
+			scheduler->Acquire(RequestClass::READ);
+			int now = ++running;
+			int seen = max_running;
+			while (now > seen && !max_running.compare_exchange_weak(seen, now)) {
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			running--;
+			scheduler->Release();
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	REQUIRE(max_running == 2);
+	REQUIRE(scheduler->InFlight() == 0);
+}
+
+TEST_CASE("RequestScheduler only admits right away with TryAcquire", "[scheduler]") {
+	auto options = Unlimited();
+	options.maxInFlight = 1;
+	RequestScheduler scheduler(options);
+
+	REQUIRE(scheduler.TryAcquire(RequestClass::READ));
+	// No free slot
+	REQUIRE_FALSE(scheduler.TryAcquire(RequestClass::READ));
+	scheduler.Release();
+
+	options.maxInFlight = 0;
+	options.readsPerMinute = 60;
+	options.burstSeconds = 1;
+	scheduler.Configure(options);
+	REQUIRE(scheduler.TryAcquire(RequestClass::READ));
+	scheduler.Release();
+	// No token left until the next second
+	REQUIRE_FALSE(scheduler.TryAcquire(RequestClass::READ));
+	REQUIRE(scheduler.InFlight() == 0);
+}
+
+TEST_CASE("RequestScheduler admits waiting reads before waiting writes", "[scheduler]") {
+	auto options = Unlimited();
+	options.maxInFlight = 1;
+	RequestScheduler scheduler(options);
+	std::mutex order_lock;
+	std::vector<RequestClass> order;
+
+	// Hold the only slot while a write and then a read queue up
+	scheduler.Acquire(RequestClass::UNMETERED);
+	auto request = [&](RequestClass requestClass) {
+		return std::thread([&, requestClass]() {
+			scheduler.Acquire(requestClass);
+			{
+				std::lock_guard<std::mutex> guard(order_lock);
+				order.push_back(requestClass);
+			}
+			scheduler.Release();
+		});
+	};
+	auto write = request(RequestClass::WRITE);
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	auto read = request(RequestClass::READ);
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	scheduler.Release();
+	write.join();
+	read.join();
+
+	REQUIRE(order == std::vector<RequestClass> {RequestClass::READ, RequestClass::WRITE});
+}
+
+TEST_CASE("SchedulingHttpClient releases its slot when the request fails", "[scheduler]") {
+	auto options = Unlimited();
+	options.maxInFlight = 1;
+	auto scheduler = std::make_shared<RequestScheduler>(options);
+	auto mock = new MockHttpClient();
+	Metrics metrics;
+	SchedulingHttpClient client(std::unique_ptr<MockHttpClient>(mock), scheduler, metrics);
+
+	// No response queued, the mock throws
+	REQUIRE_THROWS(client.Execute(Request(HttpMethod::GET, "https://sheets.googleapis.com/v4/spreadsheets/abc")));
+	REQUIRE(scheduler->InFlight() == 0);
+	mock->AddResponse({200, {}, "{}"});
+	REQUIRE(client.Execute(Request(HttpMethod::GET, "https://sheets.googleapis.com/v4/spreadsheets/abc")).statusCode ==
+	        200);
+}
@@ -0,0 +1,164 @@
+#include "catch.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "sheets/transport/mock_http_client.hpp"
+#include "sheets/transport/retry_http_client.hpp"
+
+using duckdb::sheets::HttpMethod;
+using duckdb::sheets::HttpRequest;
+using duckdb::sheets::HttpResponse;
+using duckdb::sheets::IHttpClient;
+using duckdb::sheets::Metrics;
+using duckdb::sheets::MockHttpClient;
+using duckdb::sheets::RetryHttpClient;
+using duckdb::sheets::RetryOptions;
+
+static HttpRequest Request(HttpMethod method, const std::string &url) {
+	HttpRequest request;
+	request.method = method;
+	request.url = url;
+	return request;
+}
+
+static const std::string VALUES_URL = "https://sheets.googleapis.com/v4/spreadsheets/abc123/values/Sheet1";
+
+// Records the waits instead of sleeping
+static RetryOptions Options(std::vector<int64_t> &waits, int maxRetries = 3) {
+	RetryOptions options;
+	options.maxRetries = maxRetries;
+	options.initialBackoff = std::chrono::milliseconds(100);
+	options.maxBackoff = std::chrono::milliseconds(1000);
+	options.sleep = [&waits](std::chrono::milliseconds delay) { waits.push_back(delay.count()); };
+	return options;
+}
+
+// Fails with a transport error a number of times, then answers 200
+class FlakyHttpClient : public IHttpClient {
+public:
+	explicit FlakyHttpClient(int failures) : failures(failures) {
+	}
+
+	HttpResponse Execute(const HttpRequest &request) override {
+		calls++;
+		if (calls <= failures) {
+			throw std::runtime_error("connection reset");
+		}
+		return HttpResponse {200, {}, "{}"};
+	}
+
+	int failures;
+	int calls = 0;
+};
+
+TEST_CASE("RetryHttpClient retries rate limited and failed GETs with growing backoff", "[retry]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({429, {}, ""});
+	mock->AddResponse({503, {}, ""});
+	mock->AddResponse({200, {}, "{}"});
+	Metrics metrics;
+	std::vector<int64_t> waits;
+	RetryHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, Options(waits));
+
+	auto response = client.Execute(Request(HttpMethod::GET, VALUES_URL));
+
+	REQUIRE(response.statusCode == 200);
+	REQUIRE(mock->GetRecordedRequests().size() == 3);
+	REQUIRE(waits.size() == 2);
+	REQUIRE(waits[0] >= 50);
+	REQUIRE(waits[0] <= 100);
+	REQUIRE(waits[1] >= 100);
+	REQUIRE(waits[1] <= 200);
+	REQUIRE(metrics.Get(duckdb::sheets::RETRIES_METRIC) == 2);
+	REQUIRE(metrics.Get(duckdb::sheets::RETRY_WAIT_MS_METRIC) == waits[0] + waits[1]);
+}
+
+TEST_CASE("RetryHttpClient waits as long as Retry-After asks, up to the maximum backoff", "[retry]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({429, {{"retry-after", "0"}}, ""});
+	mock->AddResponse({503, {{"Retry-After", "30"}}, ""});
+	mock->AddResponse({200, {}, "{}"});
+	Metrics metrics;
+	std::vector<int64_t> waits;
+	RetryHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, Options(waits));
+
+	client.Execute(Request(HttpMethod::GET, VALUES_URL));
+
+	REQUIRE(waits == std::vector<int64_t> {0, 1000});
+}
+
+TEST_CASE("RetryHttpClient returns the last failure once retries are used up", "[retry]") {
+	auto mock = new MockHttpClient();
+	for (int i = 0; i < 3; i++) {
+		mock->AddResponse({500, {}, "error"});
+	}
+	Metrics metrics;
+	std::vector<int64_t> waits;
+	RetryHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, Options(waits, 2));
+
+	auto response = client.Execute(Request(HttpMethod::PUT, VALUES_URL));
+
+	REQUIRE(response.statusCode == 500);
+	REQUIRE(mock->GetRecordedRequests().size() == 3);
+	REQUIRE(metrics.Get(duckdb::sheets::RETRIES_EXHAUSTED_METRIC) == 1);
+}
+
+TEST_CASE("RetryHttpClient doesn't retry client errors", "[retry]") {
+	auto mock = new MockHttpClient();
+	mock->AddResponse({404, {}, ""});
+	Metrics metrics;
+	std::vector<int64_t> waits;
+	RetryHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, Options(waits));
+
+	REQUIRE(client.Execute(Request(HttpMethod::GET, VALUES_URL)).statusCode == 404);
+	REQUIRE(mock->GetRecordedRequests().size() == 1);
+	REQUIRE(waits.empty());
+}
+
+TEST_CASE("RetryHttpClient only retries appends the server rejected", "[retry]") {
+	auto append_url = VALUES_URL + ":append?valueInputOption=USER_ENTERED";
+	auto mock = new MockHttpClient();
+	mock->AddResponse({429, {}, ""});
+	mock->AddResponse({200, {}, "{}"});
+	mock->AddResponse({503, {}, ""});
+	Metrics metrics;
+	std::vector<int64_t> waits;
+	RetryHttpClient client(std::unique_ptr<MockHttpClient>(mock), metrics, Options(waits));
+
+	// A 429 was not applied and is sent again
+	REQUIRE(client.Execute(Request(HttpMethod::POST, append_url)).statusCode == 200);
+	// A 503 may have been applied, sending it again could append the rows twice
+	REQUIRE(client.Execute(Request(HttpMethod::POST, append_url)).statusCode == 503);
+	REQUIRE(mock->GetRecordedRequests().size() == 3);
+}
+
+TEST_CASE("RetryHttpClient retries transport errors of idempotent requests only", "[retry]") {
+	Metrics metrics;
+	std::vector<int64_t> waits;
+
+	auto flaky_get = new FlakyHttpClient(2);
+	RetryHttpClient get_client(std::unique_ptr<IHttpClient>(flaky_get), metrics, Options(waits));
+	REQUIRE(get_client.Execute(Request(HttpMethod::GET, VALUES_URL)).statusCode == 200);
+	REQUIRE(flaky_get->calls == 3);
+
+	auto flaky_append = new FlakyHttpClient(1);
+	RetryHttpClient append_client(std::unique_ptr<IHttpClient>(flaky_append), metrics, Options(waits));
+	REQUIRE_THROWS_AS(append_client.Execute(Request(HttpMethod::POST, VALUES_URL + ":append")), std::runtime_error);
+	REQUIRE(flaky_append->calls == 1);
+
+	auto flaky_clear = new FlakyHttpClient(1);
+	RetryHttpClient clear_client(std::unique_ptr<IHttpClient>(flaky_clear), metrics, Options(waits));
+	REQUIRE(clear_client.Execute(Request(HttpMethod::POST, VALUES_URL + ":clear")).statusCode == 200);
+}
+
+TEST_CASE("IsIdempotentRequest classifies Sheets requests", "[retry]") {
+	using duckdb::sheets::IsIdempotentRequest;
+	REQUIRE(IsIdempotentRequest(Request(HttpMethod::GET, VALUES_URL)));
+	REQUIRE(IsIdempotentRequest(Request(HttpMethod::PUT, VALUES_URL + "?valueInputOption=USER_ENTERED")));
+	REQUIRE(IsIdempotentRequest(Request(HttpMethod::POST, VALUES_URL + ":clear")));
+	REQUIRE(IsIdempotentRequest(Request(HttpMethod::POST, "https://oauth2.googleapis.com/token")));
+	REQUIRE_FALSE(IsIdempotentRequest(Request(HttpMethod::POST, VALUES_URL + ":append?valueInputOption=RAW")));
+	REQUIRE_FALSE(
+	    IsIdempotentRequest(Request(HttpMethod::POST, "https://sheets.googleapis.com/v4/spreadsheets/abc:batchUpdate")));
+}
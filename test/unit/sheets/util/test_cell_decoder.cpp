@@ -0,0 +1,78 @@
+#include "catch.hpp"
+
+#include "sheets/exception.hpp"
+#include "sheets/util/cell_decoder.hpp"
+
+using Kind = duckdb::sheets::CellValue::Kind;
+
+TEST_CASE("DecodeCellRange keeps the type of each cell", "[cell_decoder]") {
+	auto range = duckdb::sheets::DecodeCellRange(R"({
+		"range": "Sheet1!A1:D2",
+		"majorDimension": "ROWS",
+		"values": [["name", 1.5, true, ""], [null, -3, false]]
+	})");
+
+	REQUIRE(range.range == "Sheet1!A1:D2");
+	REQUIRE(range.majorDimension == duckdb::sheets::ROWS);
+	REQUIRE(range.values.LineCount() == 2);
+	REQUIRE(range.values.LineSize(0) == 4);
+	REQUIRE(range.values.Get(0, 0).kind == Kind::STRING);
+	REQUIRE(range.values.Get(0, 0).Text() == "name");
+	REQUIRE(range.values.Get(0, 1).kind == Kind::NUMBER);
+	REQUIRE(range.values.Get(0, 1).number == 1.5);
+	REQUIRE(range.values.Get(0, 2).kind == Kind::BOOLEAN);
+	REQUIRE(range.values.Get(0, 2).number == 1);
+	REQUIRE(range.values.Get(0, 3).IsEmpty());
+	REQUIRE(range.values.LineSize(1) == 3);
+	REQUIRE(range.values.Get(1, 0).IsEmpty());
+	REQUIRE(range.values.Get(1, 1).number == -3);
+	REQUIRE(range.values.Get(1, 2).number == 0);
+}
+
+TEST_CASE("DecodeCellRange skips unknown keys and nested values", "[cell_decoder]") {
+	auto range = duckdb::sheets::DecodeCellRange(R"({
+		"extra": {"values": [["x"]], "range": "wrong"},
+		"list": [["y"]],
+		"majorDimension": "COLUMNS",
+		"values": [["a", "b"]],
+		"range": "Sheet1!A1:A2"
+	})");
+
+	REQUIRE(range.range == "Sheet1!A1:A2");
+	REQUIRE(range.majorDimension == duckdb::sheets::COLUMNS);
+	REQUIRE(range.values.LineCount() == 1);
+	REQUIRE(range.values.LineSize(0) == 2);
+	REQUIRE(range.values.Get(0, 1).Text() == "b");
+}
+
+TEST_CASE("DecodeCellRange without values", "[cell_decoder]") {
+	auto range = duckdb::sheets::DecodeCellRange(R"({"range": "Sheet1!A1:B2", "majorDimension": "ROWS"})");
+	REQUIRE(range.range == "Sheet1!A1:B2");
+	REQUIRE(range.values.Empty());
+}
+
+TEST_CASE("DecodeBatchGetCells returns ranges in order", "[cell_decoder]") {
+	auto response = duckdb::sheets::DecodeBatchGetCells(R"({
+		"spreadsheetId": "abc",
+		"valueRanges": [
+			{"range": "Sheet1!A1:A2", "values": [["a"], [1]]},
+			{"range": "Sheet1!C1:C2"},
+			{"range": "Sheet1!E1:E2", "values": [["e"]]}
+		]
+	})");
+
+	REQUIRE(response.spreadsheetId == "abc");
+	REQUIRE(response.valueRanges.size() == 3);
+	REQUIRE(response.valueRanges[0].values.LineCount() == 2);
+	REQUIRE(response.valueRanges[0].values.Get(1, 0).number == 1);
+	REQUIRE(response.valueRanges[1].range == "Sheet1!C1:C2");
+	REQUIRE(response.valueRanges[1].values.Empty());
+	REQUIRE(response.valueRanges[2].values.Get(0, 0).Text() == "e");
+}
+
+TEST_CASE("DecodeCellRange throws SheetsParseException on invalid JSON", "[cell_decoder]") {
+	REQUIRE_THROWS_AS(duckdb::sheets::DecodeCellRange("not valid json"), duckdb::sheets::SheetsParseException);
+	REQUIRE_THROWS_AS(duckdb::sheets::DecodeCellRange(R"({"values": [["a")"), duckdb::sheets::SheetsParseException);
+	REQUIRE_THROWS_AS(duckdb::sheets::DecodeCellRange("[]"), duckdb::sheets::SheetsParseException);
+	REQUIRE_THROWS_AS(duckdb::sheets::DecodeBatchGetCells("{"), duckdb::sheets::SheetsParseException);
+}
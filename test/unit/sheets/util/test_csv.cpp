@@ -0,0 +1,36 @@
+#include "catch.hpp"
+
+#include "sheets/exception.hpp"
+#include "sheets/util/csv.hpp"
+
+TEST_CASE("ParseCsv empty input", "[csv]") {
+	REQUIRE(duckdb::sheets::ParseCsv("").empty());
+	REQUIRE(duckdb::sheets::ParseCsv("\n").empty());
+}
+
+TEST_CASE("ParseCsv quoted fields", "[csv]") {
+	auto rows = duckdb::sheets::ParseCsv("\"name\",\"age\"\n\"Alice\",\"30\"\n\"\",\"\"\n");
+	REQUIRE(rows.size() == 3);
+	REQUIRE(rows[0] == std::vector<std::string> {"name", "age"});
+	REQUIRE(rows[1] == std::vector<std::string> {"Alice", "30"});
+	REQUIRE(rows[2] == std::vector<std::string> {"", ""});
+}
+
+TEST_CASE("ParseCsv separators, line breaks and quotes inside quotes", "[csv]") {
+	auto rows = duckdb::sheets::ParseCsv("\"a,b\",\"line\nbreak\",\"say \"\"hi\"\"\"\r\n");
+	REQUIRE(rows.size() == 1);
+	REQUIRE(rows[0][0] == "a,b");
+	REQUIRE(rows[0][1] == "line\nbreak");
+	REQUIRE(rows[0][2] == "say \"hi\"");
+}
+
+TEST_CASE("ParseCsv unquoted fields and missing final line break", "[csv]") {
+	auto rows = duckdb::sheets::ParseCsv("a,,c\nd,e,f");
+	REQUIRE(rows.size() == 2);
+	REQUIRE(rows[0] == std::vector<std::string> {"a", "", "c"});
+	REQUIRE(rows[1] == std::vector<std::string> {"d", "e", "f"});
+}
+
+TEST_CASE("ParseCsv throws on unterminated quote", "[csv]") {
+	REQUIRE_THROWS_AS(duckdb::sheets::ParseCsv("\"a,b\n"), duckdb::sheets::SheetsParseException);
+}
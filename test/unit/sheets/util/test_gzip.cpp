@@ -0,0 +1,32 @@
+#include "catch.hpp"
+
+#include "sheets/exception.hpp"
+#include "sheets/util/gzip.hpp"
+
+using duckdb::sheets::GzipCompress;
+using duckdb::sheets::GzipDecompress;
+
+TEST_CASE("GzipCompress output round trips through GzipDecompress", "[gzip]") {
+	std::string body;
+	for (int i = 0; i < 10000; i++) {
+		body += R"(["Alice", "30", "Toronto"],)";
+	}
+	auto compressed = GzipCompress(body);
+
+	// gzip magic bytes
+	REQUIRE(static_cast<unsigned char>(compressed[0]) == 0x1f);
+	REQUIRE(static_cast<unsigned char>(compressed[1]) == 0x8b);
+	REQUIRE(compressed.size() * 10 < body.size());
+	REQUIRE(GzipDecompress(compressed) == body);
+}
+
+TEST_CASE("GzipDecompress handles empty bodies", "[gzip]") {
+	REQUIRE(GzipDecompress(GzipCompress("")) == "");
+}
+
+TEST_CASE("GzipDecompress throws on corrupt or truncated data", "[gzip]") {
+	auto compressed = GzipCompress("some response body that is long enough to be truncated");
+	REQUIRE_THROWS_AS(GzipDecompress(compressed.substr(0, compressed.size() / 2)),
+	                  duckdb::sheets::SheetsParseException);
+	REQUIRE_THROWS_AS(GzipDecompress("not gzip at all"), duckdb::sheets::SheetsParseException);
+}